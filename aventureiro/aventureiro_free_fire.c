@@ -5,7 +5,8 @@
  * ========================================
  *
  * Este programa implementa um sistema de inventário comparando
- * DUAS estruturas de dados: vetores e listas encadeadas.
+ * estruturas de dados: vetores, listas encadeadas e listas
+ * encadeadas desenroladas (vários itens por nó).
  *
  * Objetivo:
  * - Demonstrar diferenças de performance entre vetores e listas
@@ -16,20 +17,47 @@
  * Funcionalidades:
  * - Cadastro de itens em vetor ou lista encadeada
  * - Remoção de itens
- * - Listagem de todos os itens
+ * - Listagem paginada de todos os itens (saída bufferizada)
  * - Busca sequencial com contador de comparações
- * - Ordenação de vetor (Selection Sort)
+ * - Ordenação de vetor (Introsort: Quick + Heap + Insertion Sort)
+ * - Ordenação da lista (Merge Sort bottom-up, religando os nós)
  * - Busca binária com contador de comparações
+ * - Modo "sempre ordenado" do vetor (inserção binária + memmove)
  * - Comparação de performance entre estruturas
+ * - Lista com ponteiro de cauda (inserção O(1)) e pool de nós
+ * - Lista desenrolada: inserção de lista com localidade de vetor
+ * - Skip list: lista ordenada por nome com busca O(log n) esperado
+ * - Benchmark vetor x lista com N sintético (CSV ou JSON)
+ * - Dicionário de tipos: cada item guarda só o número do seu tipo
+ * - Snapshot binário do vetor: registros de tamanho fixo, mapeados e
+ *   usados no lugar na abertura (--snapshot arquivo; gravado ao sair)
+ *
+ * Uso: aventureiro [--snapshot arquivo] [--benchmark [--max N] [--json] [--saida arquivo]]
  *
  * Autor: Estrutura de Dados - Nível Aventureiro
  * Data: 2026
  */
 
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // clock_gettime, fsync, fileno
+#endif
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <time.h>
+#include <errno.h>
+#include <limits.h>
+
+#ifdef _WIN32
+#include <windows.h> // QueryPerformanceCounter
+#else
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close, fsync, write
+#endif
 
 /* ========================================
  * DEFINIÇÃO DE STRUCTS
@@ -37,18 +65,29 @@
  *
  * Item: estrutura que armazena informações sobre um item
  * - nome: identificação do item (ex: "Rifle AK")
- * - tipo: categoria do item (ex: "arma", "munição", "cura")
+ * - tipo: categoria do item (ex: "arma", "munição", "cura"), guardada
+ *   como o número do tipo na seção DICIONÁRIO DE TIPOS
  * - quantidade: número de unidades desse item
  *
  * No: nó da lista encadeada
  * - dados: contém as informações do item
  * - proximo: ponteiro para o próximo nó (ou NULL)
+ *
+ * NoDesenrolado: nó da lista desenrolada
+ * - quantidade: itens ocupados no nó
+ * - itens: bloco contíguo com até ITENS_POR_NO itens
+ * - proximo: ponteiro para o próximo nó (ou NULL)
+ *
+ * NoSkip: nó da skip list (lista ordenada em vários níveis)
+ * - dados: contém as informações do item
+ * - nivel: quantos níveis o nó ocupa (1..NIVEL_MAXIMO_SKIP)
+ * - proximo: um ponteiro de avanço por nível
  */
 
 typedef struct
 {
     char nome[30];
-    char tipo[20];
+    unsigned char tipo;
     int quantidade;
 } Item;
 
@@ -58,11 +97,30 @@ typedef struct No
     struct No *proximo;
 } No;
 
+#define ITENS_POR_NO 16
+
+typedef struct NoDesenrolado
+{
+    int quantidade;
+    Item itens[ITENS_POR_NO];
+    struct NoDesenrolado *proximo;
+} NoDesenrolado;
+
+#define NIVEL_MAXIMO_SKIP 16
+
+typedef struct NoSkip
+{
+    Item dados;
+    int nivel;
+    struct NoSkip *proximo[]; // nivel ponteiros, alocados junto com o nó
+} NoSkip;
+
 /* ========================================
  * CONSTANTES E VARIÁVEIS GLOBAIS
  * ========================================
  *
- * MAX_ITENS: limite de itens na mochila
+ * MAX_ITENS: limite de itens na mochila (regra do jogo, aplicada nos
+ *            menus; o vetor em si cresce sob demanda)
  * Contadores globais para comparações
  * Arrays e listas para armazenar dados
  */
@@ -71,435 +129,3643 @@ typedef struct No
 #define LINHA "===================================================="
 
 // Estruturas de dados - VETOR
-Item mochilaVetor[MAX_ITENS];
+Item *mochilaVetor = NULL;
+int capacidadeVetor = 0;
 int totalItensVetor = 0;
 int comparacoesSequencialVetor = 0;
 int comparacoesBinariaVetor = 0;
+int comparacoesOrdenacaoVetor = 0;
+int comparacoesInsercaoVetor = 0;
+int vetorOrdenado = 1;     // 1 enquanto os itens estiverem em ordem de nome
+int modoVetorOrdenado = 0; // 1: cada inserção vai direto para a posição certa
 
 // Estruturas de dados - LISTA ENCADEADA
 No *mochilaLista = NULL;
+No *caudaLista = NULL; // Último nó: permite inserir no final em O(1)
 int totalItensLista = 0;
 int comparacoesSequencialLista = 0;
+int comparacoesOrdenacaoLista = 0;
 
-/* ========================================
- * FUNÇÕES - VETOR (Lista Sequencial)
- * ======================================== */
+// Estruturas de dados - LISTA DESENROLADA
+NoDesenrolado *mochilaDesenrolada = NULL;
+NoDesenrolado *caudaDesenrolada = NULL;
+int totalItensDesenrolada = 0;
+int comparacoesSequencialDesenrolada = 0;
 
-/*
- * Função: inserirItemVetor
- * Descrição: adiciona um novo item no vetor
- * Parâmetros: nome, tipo, quantidade do item
- * Retorno: 1 se sucesso, 0 se falhou
+// Estruturas de dados - SKIP LIST (ordenada por nome)
+NoSkip *cabecaSkip = NULL; // Sentinela com todos os níveis
+int nivelSkip = 1;         // Níveis em uso no momento
+int totalItensSkip = 0;
+int comparacoesSkip = 0;      // Última operação (inserir, remover ou buscar)
+int comparacoesBuscaSkip = 0; // Última busca
+
+/* ========================================
+ * DICIONÁRIO DE TIPOS
+ * ========================================
+ *
+ * Poucos tipos se repetem em todos os itens (arma, munição, cura...).
+ * Cada nome de tipo fica guardado uma vez só aqui e o Item leva apenas
+ * o número dele: sizeof(Item) cai de 56 para 36 bytes e o nó da lista
+ * (No) de 64 para 48, e o mesmo vale para cada item da lista
+ * desenrolada e da skip list. Os números seguem a ordem de criação e
+ * não mudam; o dicionário só cresce.
  */
-int inserirItemVetor(const char *nome, const char *tipo, int quantidade)
-{
-    if (totalItensVetor >= MAX_ITENS)
-    {
-        return 0;
-    }
 
-    strcpy(mochilaVetor[totalItensVetor].nome, nome);
-    strcpy(mochilaVetor[totalItensVetor].tipo, tipo);
-    mochilaVetor[totalItensVetor].quantidade = quantidade;
+#define MAX_TIPOS 256   // números de tipo cabem em um unsigned char
+#define TAMANHO_TIPO 20 // maior nome de tipo, com o '\0'
 
-    totalItensVetor++;
-    return 1;
-}
+char nomesTipos[MAX_TIPOS][TAMANHO_TIPO]; // Nome de cada tipo, pelo número
+int totalTipos = 0;                       // Tipos já criados
 
 /*
- * Função: removerItemVetor
- * Descrição: remove um item do vetor pelo nome
- * Parâmetros: nome do item a remover
- * Retorno: 1 se sucesso, 0 se falhou
+ * Função: procurarTipo
+ * Descrição: procura um tipo no dicionário sem criá-lo
+ * Parâmetros: nome do tipo (truncado como ao guardar)
+ * Retorno: número do tipo ou -1 se não existe
  */
-int removerItemVetor(const char *nome)
+int procurarTipo(const char *tipo)
 {
-    int indice = -1;
+    char nome[TAMANHO_TIPO];
+    snprintf(nome, sizeof(nome), "%s", tipo);
 
-    // Busca sequencial do item
-    for (int i = 0; i < totalItensVetor; i++)
+    for (int i = 0; i < totalTipos; i++)
     {
-        if (strcmp(mochilaVetor[i].nome, nome) == 0)
+        if (strcmp(nomesTipos[i], nome) == 0)
         {
-            indice = i;
-            break;
+            return i;
         }
     }
+    return -1;
+}
 
-    if (indice == -1)
-    {
-        return 0;
-    }
+/*
+ * Função: internarTipo
+ * Descrição: devolve o número de um tipo, criando-o se for novo
+ * Parâmetros: nome do tipo (truncado em TAMANHO_TIPO - 1 caracteres)
+ * Retorno: número do tipo ou -1 se o dicionário está cheio
+ */
+int internarTipo(const char *tipo)
+{
+    int numero = procurarTipo(tipo);
 
-    // Remove o item deslocando os posteriores
-    for (int i = indice; i < totalItensVetor - 1; i++)
+    if (numero == -1 && totalTipos < MAX_TIPOS)
     {
-        mochilaVetor[i] = mochilaVetor[i + 1];
+        // Resto zerado: o dicionário vai para o snapshot como está
+        numero = totalTipos++;
+        memset(nomesTipos[numero], 0, TAMANHO_TIPO);
+        memcpy(nomesTipos[numero], tipo, strnlen(tipo, TAMANHO_TIPO - 1));
     }
+    return numero;
+}
 
-    totalItensVetor--;
-    return 1;
+/*
+ * Função: nomeDoTipo
+ * Descrição: converte o número de um tipo no seu nome
+ * Parâmetros: número do tipo
+ * Retorno: nome do tipo ("?" se o número não existe no dicionário)
+ */
+const char *nomeDoTipo(int numero)
+{
+    return numero >= 0 && numero < totalTipos ? nomesTipos[numero] : "?";
 }
 
+char tiposGuardados[MAX_TIPOS][TAMANHO_TIPO]; // Dicionário do jogador durante as medições
+int totalTiposGuardados = 0;
+
 /*
- * Função: listarItensVetor
- * Descrição: exibe todos os itens do vetor em formato tabular
+ * Função: guardarTipos
+ * Descrição: põe o dicionário do jogador de lado e começa um vazio
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Usada pelas medições com itens sintéticos, para que os tipos delas
+ * não entrem no snapshot do jogador. Cada chamada deve ser seguida de
+ * restaurarTipos (sem aninhar).
+ */
+void guardarTipos()
+{
+    memcpy(tiposGuardados, nomesTipos, sizeof(nomesTipos));
+    totalTiposGuardados = totalTipos;
+    totalTipos = 0;
+}
+
+/*
+ * Função: restaurarTipos
+ * Descrição: devolve o dicionário guardado por guardarTipos
  * Parâmetros: nenhum
  * Retorno: nenhum
  */
-void listarItensVetor()
+void restaurarTipos()
 {
-    printf("\n%s\n", LINHA);
-    printf("           📦 ITENS DO INVENTÁRIO (VETOR) 📦\n");
-    printf("%s\n", LINHA);
+    memcpy(nomesTipos, tiposGuardados, sizeof(nomesTipos));
+    totalTipos = totalTiposGuardados;
+}
 
-    if (totalItensVetor == 0)
-    {
-        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
-        printf("%s\n\n", LINHA);
-        return;
-    }
+/* ========================================
+ * SAÍDA BUFFERIZADA E PAGINAÇÃO
+ * ========================================
+ *
+ * As tabelas são formatadas em um único buffer reutilizável e enviadas
+ * ao terminal com uma escrita por página, em vez de um printf por
+ * linha. Listagens mostram TAMANHO_PAGINA itens por vez.
+ */
 
-    printf("Total de itens: %d/%d\n\n", totalItensVetor, MAX_ITENS);
+#define TAMANHO_PAGINA 50
+#define TAMANHO_BUFFER_SAIDA 16384
 
-    printf("┌────┬──────────────────────────┬────────────────┬────────────┐\n");
-    printf("│ #  │ Nome do Item             │ Tipo           │ Quantidade │\n");
-    printf("├────┼──────────────────────────┼────────────────┼────────────┤\n");
+char bufferSaida[TAMANHO_BUFFER_SAIDA]; // Buffer reutilizado por todas as páginas
+size_t usoBufferSaida = 0;              // Bytes pendentes no buffer
 
-    for (int i = 0; i < totalItensVetor; i++)
+/*
+ * Função: descarregarBuffer
+ * Descrição: envia o conteúdo pendente do buffer ao terminal
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * O stdout é esvaziado antes para manter a ordem com os printf comuns;
+ * depois a página vai direto ao descritor, sem passar de novo pelo
+ * buffer do stdio. Escritas parciais continuam de onde pararam e
+ * interrupções por sinal (EINTR) são repetidas. Se a saída falhar (ex:
+ * terminal ou pipe fechado), o restante da página é descartado.
+ */
+void descarregarBuffer()
+{
+    if (usoBufferSaida == 0)
     {
-        printf("│ %2d │ %-24s │ %-14s │ %10d │\n",
-               i + 1,
-               mochilaVetor[i].nome,
-               mochilaVetor[i].tipo,
-               mochilaVetor[i].quantidade);
+        return;
     }
 
-    printf("└────┴──────────────────────────┴────────────────┴────────────┘\n");
-    printf("\n");
+    fflush(stdout);
+#ifdef _WIN32
+    fwrite(bufferSaida, 1, usoBufferSaida, stdout);
+    fflush(stdout);
+#else
+    size_t enviados = 0;
+    while (enviados < usoBufferSaida)
+    {
+        ssize_t escritos = write(STDOUT_FILENO, bufferSaida + enviados, usoBufferSaida - enviados);
+        if (escritos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (escritos <= 0)
+        {
+            break;
+        }
+        enviados += (size_t)escritos;
+    }
+#endif
+    usoBufferSaida = 0;
 }
 
 /*
- * Função: buscarSequencialVetor
- * Descrição: busca item no vetor sequencialmente e conta comparações
- * Parâmetros: nome do item
- * Retorno: índice do item ou -1 se não encontrado
+ * Função: anexarBuffer
+ * Descrição: formata texto (como printf) no final do buffer de saída
+ * Parâmetros: formato e argumentos
+ * Retorno: nenhum
+ *
+ * Se o texto não couber, o buffer é descarregado antes.
  */
-int buscarSequencialVetor(const char *nome)
+void anexarBuffer(const char *formato, ...)
 {
-    comparacoesSequencialVetor = 0;
+    va_list argumentos;
 
-    for (int i = 0; i < totalItensVetor; i++)
+    va_start(argumentos, formato);
+    int tamanho = vsnprintf(bufferSaida + usoBufferSaida,
+                            TAMANHO_BUFFER_SAIDA - usoBufferSaida, formato, argumentos);
+    va_end(argumentos);
+
+    if (tamanho < 0)
     {
-        comparacoesSequencialVetor++;
-        if (strcmp(mochilaVetor[i].nome, nome) == 0)
+        return;
+    }
+
+    if ((size_t)tamanho >= TAMANHO_BUFFER_SAIDA - usoBufferSaida)
+    {
+        descarregarBuffer();
+
+        va_start(argumentos, formato);
+        tamanho = vsnprintf(bufferSaida, TAMANHO_BUFFER_SAIDA, formato, argumentos);
+        va_end(argumentos);
+
+        if (tamanho >= TAMANHO_BUFFER_SAIDA)
         {
-            return i;
+            tamanho = TAMANHO_BUFFER_SAIDA - 1; // texto truncado
         }
     }
 
-    return -1;
+    usoBufferSaida += (size_t)tamanho;
 }
 
 /*
- * Função: ordenarVetor (Selection Sort)
- * Descrição: ordena os itens do vetor alfabeticamente por nome
+ * Função: anexarCabecalhoTabela
+ * Descrição: grava no buffer a faixa exibida e o cabeçalho da tabela
+ * Parâmetros: ordem do primeiro item, máximo de itens, total de itens
+ * Retorno: nenhum
+ */
+void anexarCabecalhoTabela(int inicio, int limite, int total)
+{
+    anexarBuffer("Itens %d a %d de %d\n\n",
+                 inicio + 1,
+                 inicio + limite < total ? inicio + limite : total,
+                 total);
+    anexarBuffer("┌─────────┬──────────────────────────┬────────────────┬────────────┐\n");
+    anexarBuffer("│ #       │ Nome do Item             │ Tipo           │ Quantidade │\n");
+    anexarBuffer("├─────────┼──────────────────────────┼────────────────┼────────────┤\n");
+}
+
+/*
+ * Função: anexarLinhaTabela
+ * Descrição: grava no buffer uma linha da tabela de itens
+ * Parâmetros: número exibido e item
+ * Retorno: nenhum
+ */
+void anexarLinhaTabela(int numero, const Item *item)
+{
+    anexarBuffer("│ %7d │ %-24s │ %-14s │ %10d │\n",
+                 numero,
+                 item->nome,
+                 nomeDoTipo(item->tipo),
+                 item->quantidade);
+}
+
+/*
+ * Função: fecharTabela
+ * Descrição: grava o rodapé da tabela e envia a página ao terminal
  * Parâmetros: nenhum
  * Retorno: nenhum
- *
- * Complexidade: O(n²)
- * Estratégia: encontra o menor elemento e coloca no início
  */
-void ordenarVetor()
+void fecharTabela()
 {
-    printf("\n⏳ Ordenando itens (Selection Sort)...\n");
+    anexarBuffer("└─────────┴──────────────────────────┴────────────────┴────────────┘\n\n");
+    descarregarBuffer();
+}
 
-    for (int i = 0; i < totalItensVetor - 1; i++)
+/*
+ * Função: paginarTabela
+ * Descrição: exibe uma tabela página a página
+ * Parâmetros: total de itens, função que exibe uma página (inicio, limite),
+ *             1 para perguntar antes de cada página, 0 para mostrar só a primeira
+ * Retorno: nenhum
+ */
+void paginarTabela(int total, void (*exibirPagina)(int, int), int interativo)
+{
+    for (int inicio = 0; inicio < total; inicio += TAMANHO_PAGINA)
     {
-        int menorIndice = i;
-
-        // Encontra o índice do menor elemento
-        for (int j = i + 1; j < totalItensVetor; j++)
+        if (inicio > 0)
         {
-            if (strcmp(mochilaVetor[j].nome, mochilaVetor[menorIndice].nome) < 0)
+            if (!interativo)
             {
-                menorIndice = j;
+                printf("... e mais %d itens (use a opção 3 para ver todos)\n\n", total - inicio);
+                break;
             }
-        }
 
-        // Troca os elementos
-        if (menorIndice != i)
-        {
-            Item temp = mochilaVetor[i];
-            mochilaVetor[i] = mochilaVetor[menorIndice];
-            mochilaVetor[menorIndice] = temp;
+            char resposta[16];
+            printf("[Enter] próxima página  |  [q] parar: ");
+            if (fgets(resposta, sizeof(resposta), stdin) == NULL ||
+                resposta[0] == 'q' || resposta[0] == 'Q')
+            {
+                break;
+            }
         }
+        exibirPagina(inicio, TAMANHO_PAGINA);
     }
-
-    printf("✅ Itens ordenados alfabeticamente!\n");
 }
 
 /*
- * Função: buscarBinariaVetor
- * Descrição: busca item no vetor ordenado usando busca binária
- * Parâmetros: nome do item
- * Retorno: índice do item ou -1 se não encontrado
+ * Função: exibirContagem
+ * Descrição: imprime "total/MAX_ITENS" (sem quebra de linha)
+ * Parâmetros: total de itens
+ * Retorno: nenhum
  *
- * Precondição: vetor deve estar ORDENADO
- * Complexidade: O(log n)
+ * Um snapshot pode trazer mais itens que o limite do jogo; nesse caso
+ * mostra só o total e avisa que o limite foi ultrapassado, em vez de
+ * algo como "2000000/10".
  */
-int buscarBinariaVetor(const char *nome)
+void exibirContagem(int total)
 {
-    comparacoesBinariaVetor = 0;
-    int esquerda = 0;
-    int direita = totalItensVetor - 1;
-
-    while (esquerda <= direita)
+    if (total <= MAX_ITENS)
     {
-        comparacoesBinariaVetor++;
-        int meio = (esquerda + direita) / 2;
-        int comparacao = strcmp(mochilaVetor[meio].nome, nome);
-
-        if (comparacao == 0)
-        {
-            return meio; // Encontrado!
-        }
-        else if (comparacao < 0)
-        {
-            esquerda = meio + 1; // Procura na metade direita
-        }
-        else
-        {
-            direita = meio - 1; // Procura na metade esquerda
-        }
+        printf("%d/%d", total, MAX_ITENS);
+    }
+    else
+    {
+        printf("%d (acima do limite de %d do jogo)", total, MAX_ITENS);
     }
-
-    return -1; // Não encontrado
 }
 
 /* ========================================
- * FUNÇÕES - LISTA ENCADEADA
- * ======================================== */
+ * SNAPSHOT BINÁRIO DO VETOR
+ * ========================================
+ *
+ * Formato: um CabecalhoSnapshot de 40 bytes, os totalTipos nomes do
+ * dicionário de tipos (TAMANHO_TIPO bytes cada, completados com zeros
+ * até múltiplo de 8) e totalRegistros registros Item do vetor,
+ * exatamente como ficam na memória. A carga não converte nada: o
+ * arquivo é mapeado (mmap com MAP_PRIVATE) e os registros passam a ser
+ * o próprio mochilaVetor, então abrir milhões de itens é praticamente
+ * instantâneo. Alterações ficam só na memória (cópia na escrita) até o
+ * próximo salvamento.
+ *
+ * O vetor não tem índices: o único estado derivado é vetorOrdenado,
+ * gravado como flag no cabeçalho. Antes de virar o vetor, cada registro
+ * é conferido numa única passada (nome terminado, tipo dentro do
+ * dicionário, quantidade positiva), e a mesma passada confirma a ordem
+ * declarada pela flag antes de liberar a busca binária. Quando o vetor
+ * precisa crescer, os itens vão para o heap e o mapeamento é desfeito.
+ * A versão 1 (tipo como texto no registro) não é mais lida. No Windows
+ * (sem mmap) os registros são lidos com um único fread.
+ */
+
+#define ASSINATURA_SNAPSHOT "FFAVENTU"
+#define VERSAO_SNAPSHOT 2
+#define MARCA_ORDEM_BYTES 0x01020304u
+#define SNAPSHOT_ORDENADO 1u // flag: itens em ordem de nome
+#define REGISTROS_POR_ESCRITA 1024
+
+typedef struct
+{
+    char assinatura[8];                // ASSINATURA_SNAPSHOT (sem '\0')
+    unsigned int versao;               // VERSAO_SNAPSHOT
+    unsigned int ordemBytes;           // MARCA_ORDEM_BYTES na ordem de quem gravou
+    unsigned int tamanhoRegistro;      // sizeof(Item) de quem gravou
+    unsigned int flags;                // SNAPSHOT_ORDENADO
+    unsigned int totalTipos;           // nomes do dicionário logo após o cabeçalho
+    unsigned int tamanhoTipo;          // TAMANHO_TIPO de quem gravou
+    unsigned long long totalRegistros; // registros logo após o dicionário
+} CabecalhoSnapshot;
+
+void *regiaoMapeada = NULL;      // Arquivo mapeado que serve de vetor (ou NULL)
+size_t tamanhoMapeado = 0;       // Bytes mapeados
+int vetorAlterado = 0;           // 1: o vetor mudou desde a carga (snapshot a gravar)
+const char *motivoSnapshot = ""; // Motivo da última falha de carga
 
 /*
- * Função: criarNo
- * Descrição: cria um novo nó para a lista encadeada
- * Parâmetros: nome, tipo, quantidade do item
- * Retorno: ponteiro para o novo nó
+ * Função: bytesDoDicionario
+ * Descrição: calcula o espaço ocupado pelo dicionário no arquivo
+ * Parâmetros: número de tipos
+ * Retorno: bytes, arredondados para múltiplo de 8 (os registros que
+ *          vêm depois ficam alinhados no mapeamento)
  */
-No *criarNo(const char *nome, const char *tipo, int quantidade)
+long long bytesDoDicionario(unsigned int tipos)
 {
-    No *novoNo = (No *)malloc(sizeof(No));
+    return ((long long)tipos * TAMANHO_TIPO + 7) / 8 * 8;
+}
 
-    if (novoNo == NULL)
+/*
+ * Função: carregarTipos
+ * Descrição: substitui o dicionário de tipos pelo gravado no snapshot
+ * Parâmetros: nomes lidos do arquivo, número de tipos
+ * Retorno: 1 se carregado, 0 se o dicionário é inválido (o dicionário
+ *          volta a ficar vazio e o motivo fica em motivoSnapshot)
+ *
+ * Os números são preservados, então os registros mapeados continuam
+ * valendo sem serem tocados. Nomes sem '\0' ou repetidos invalidam o
+ * arquivo, como no nível mestre.
+ */
+int carregarTipos(const char *nomes, unsigned int tipos)
+{
+    totalTipos = 0;
+    for (unsigned int i = 0; i < tipos; i++)
     {
-        printf("❌ Erro ao alocar memória!\n");
-        return NULL;
-    }
+        const char *nome = nomes + (size_t)i * TAMANHO_TIPO;
 
-    strcpy(novoNo->dados.nome, nome);
-    strcpy(novoNo->dados.tipo, tipo);
-    novoNo->dados.quantidade = quantidade;
-    novoNo->proximo = NULL;
-
-    return novoNo;
+        if (memchr(nome, '\0', TAMANHO_TIPO) == NULL || internarTipo(nome) != (int)i)
+        {
+            motivoSnapshot = "dicionário de tipos inválido";
+            totalTipos = 0;
+            return 0;
+        }
+    }
+    return 1;
 }
 
 /*
- * Função: inserirItemLista
- * Descrição: insere um novo item no final da lista encadeada
- * Parâmetros: nome, tipo, quantidade do item
- * Retorno: 1 se sucesso, 0 se falhou
+ * Função: validarItens
+ * Descrição: confere os registros carregados antes de virarem o vetor
+ * Parâmetros: registros, quantidade, se o cabeçalho diz que estão em
+ *             ordem de nome
+ * Retorno: 1 se em ordem de nome, 0 se fora de ordem, -1 se algum
+ *          registro é inválido (motivo em motivoSnapshot)
+ *
+ * Uma única passada O(n): a flag SNAPSHOT_ORDENADO só é aceita se a
+ * ordem se confirmar, já que a busca binária depende dela.
  */
-int inserirItemLista(const char *nome, const char *tipo, int quantidade)
+int validarItens(const Item *itens, long long total, int ordenadoDeclarado)
 {
-    No *novoNo = criarNo(nome, tipo, quantidade);
-
-    if (novoNo == NULL)
-    {
-        return 0;
-    }
+    int emOrdem = ordenadoDeclarado;
 
-    if (mochilaLista == NULL)
-    {
-        mochilaLista = novoNo;
-    }
-    else
+    for (long long i = 0; i < total; i++)
     {
-        // Encontra o último nó
-        No *atual = mochilaLista;
-        while (atual->proximo != NULL)
+        if (memchr(itens[i].nome, '\0', sizeof(itens[i].nome)) == NULL)
+        {
+            motivoSnapshot = "item com nome sem terminador";
+            return -1;
+        }
+        if (itens[i].tipo >= totalTipos)
+        {
+            motivoSnapshot = "item com tipo fora do dicionário";
+            return -1;
+        }
+        if (itens[i].quantidade <= 0)
+        {
+            motivoSnapshot = "item com quantidade inválida";
+            return -1;
+        }
+        if (emOrdem && i > 0 && strcmp(itens[i - 1].nome, itens[i].nome) > 0)
         {
-            atual = atual->proximo;
+            emOrdem = 0;
         }
-        atual->proximo = novoNo;
     }
-
-    totalItensLista++;
-    return 1;
+    return emOrdem;
 }
 
 /*
- * Função: removerItemLista
- * Descrição: remove um item da lista pelo nome
- * Parâmetros: nome do item a remover
- * Retorno: 1 se sucesso, 0 se falhou
+ * Função: validarCabecalho
+ * Descrição: confere se o cabeçalho descreve um snapshot legível aqui
+ * Parâmetros: cabeçalho, tamanho do arquivo em bytes
+ * Retorno: número de registros, ou -1 (motivo em motivoSnapshot)
  */
-int removerItemLista(const char *nome)
+long long validarCabecalho(const CabecalhoSnapshot *cabecalho, long long tamanhoArquivo)
 {
-    if (mochilaLista == NULL)
+    if (memcmp(cabecalho->assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho->assinatura)) != 0)
     {
-        return 0;
+        motivoSnapshot = "não é um snapshot do nível aventureiro";
+        return -1;
     }
-
-    // Se é o primeiro nó
-    if (strcmp(mochilaLista->dados.nome, nome) == 0)
+    if (cabecalho->ordemBytes != MARCA_ORDEM_BYTES)
+    {
+        motivoSnapshot = "gravado em uma máquina com outra ordem de bytes";
+        return -1;
+    }
+    if (cabecalho->versao != VERSAO_SNAPSHOT)
+    {
+        motivoSnapshot = "versão do formato não suportada";
+        return -1;
+    }
+    if (cabecalho->tamanhoRegistro != sizeof(Item) || cabecalho->tamanhoTipo != TAMANHO_TIPO)
+    {
+        motivoSnapshot = "tamanho de registro diferente deste programa";
+        return -1;
+    }
+    if (cabecalho->totalTipos > MAX_TIPOS)
+    {
+        motivoSnapshot = "dicionário de tipos maior que o suportado";
+        return -1;
+    }
+
+    long long inicio = (long long)sizeof(CabecalhoSnapshot) + bytesDoDicionario(cabecalho->totalTipos);
+    long long espaco = tamanhoArquivo < inicio ? -1 : (tamanhoArquivo - inicio) / (long long)sizeof(Item);
+    if (cabecalho->totalRegistros > INT_MAX || (long long)cabecalho->totalRegistros != espaco ||
+        espaco * (long long)sizeof(Item) + inicio != tamanhoArquivo)
+    {
+        motivoSnapshot = "tamanho do arquivo não confere com o cabeçalho";
+        return -1;
+    }
+
+    return (long long)cabecalho->totalRegistros;
+}
+
+/*
+ * Função: desmapearVetor
+ * Descrição: desfaz o mapeamento do snapshot (os itens já devem ter
+ *            sido copiados ou descartados)
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void desmapearVetor()
+{
+#ifndef _WIN32
+    if (regiaoMapeada != NULL)
+    {
+        munmap(regiaoMapeada, tamanhoMapeado);
+    }
+#endif
+    regiaoMapeada = NULL;
+    tamanhoMapeado = 0;
+}
+
+/*
+ * Função: carregarSnapshot
+ * Descrição: abre um snapshot e passa a usá-lo como vetor
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se carregado, 0 se o arquivo não existe, -1 se inválido
+ *          (motivo em motivoSnapshot)
+ *
+ * Deve ser chamada com o vetor e o dicionário de tipos vazios, antes
+ * de qualquer operação.
+ */
+int carregarSnapshot(const char *caminho)
+{
+    CabecalhoSnapshot cabecalho;
+    long long total;
+    Item *itens = NULL;
+
+#ifdef _WIN32
+    FILE *arquivo = fopen(caminho, "rb");
+
+    if (arquivo == NULL)
+    {
+        motivoSnapshot = strerror(errno);
+        return errno == ENOENT ? 0 : -1;
+    }
+
+    fseek(arquivo, 0, SEEK_END);
+    long long tamanhoArquivo = ftell(arquivo);
+    rewind(arquivo);
+
+    if (fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1)
+    {
+        fclose(arquivo);
+        motivoSnapshot = "arquivo menor que o cabeçalho";
+        return -1;
+    }
+
+    static char nomes[MAX_TIPOS * TAMANHO_TIPO + 8];
+
+    total = validarCabecalho(&cabecalho, tamanhoArquivo);
+    if (total >= 0)
+    {
+        size_t bytes = (size_t)bytesDoDicionario(cabecalho.totalTipos);
+        if (fread(nomes, 1, bytes, arquivo) != bytes)
+        {
+            motivoSnapshot = "erro de leitura";
+            total = -1;
+        }
+        else if (!carregarTipos(nomes, cabecalho.totalTipos))
+        {
+            total = -1;
+        }
+    }
+    if (total > 0)
+    {
+        itens = (Item *)malloc((size_t)total * sizeof(Item));
+        if (itens == NULL || fread(itens, sizeof(Item), (size_t)total, arquivo) != (size_t)total)
+        {
+            motivoSnapshot = itens == NULL ? "memória insuficiente" : "erro de leitura";
+            free(itens);
+            total = -1;
+        }
+    }
+    fclose(arquivo);
+
+    if (total < 0)
+    {
+        return -1;
+    }
+#else
+    int descritor = open(caminho, O_RDONLY);
+    struct stat info;
+
+    if (descritor == -1)
+    {
+        motivoSnapshot = strerror(errno);
+        return errno == ENOENT ? 0 : -1;
+    }
+
+    if (fstat(descritor, &info) != 0 || info.st_size < (off_t)sizeof(CabecalhoSnapshot))
+    {
+        close(descritor);
+        motivoSnapshot = "arquivo menor que o cabeçalho";
+        return -1;
+    }
+
+    // Cópia na escrita: o vetor pode ser alterado sem tocar no arquivo
+    void *regiao = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descritor, 0);
+    close(descritor); // o mapeamento continua válido
+
+    if (regiao == MAP_FAILED)
+    {
+        motivoSnapshot = strerror(errno);
+        return -1;
+    }
+
+    cabecalho = *(const CabecalhoSnapshot *)regiao;
+    total = validarCabecalho(&cabecalho, (long long)info.st_size);
+    if (total >= 0 && !carregarTipos((const char *)regiao + sizeof(CabecalhoSnapshot), cabecalho.totalTipos))
+    {
+        total = -1;
+    }
+    if (total <= 0)
+    {
+        munmap(regiao, (size_t)info.st_size);
+        if (total < 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        regiaoMapeada = regiao;
+        tamanhoMapeado = (size_t)info.st_size;
+        itens = (Item *)((char *)regiao + sizeof(CabecalhoSnapshot) + bytesDoDicionario(cabecalho.totalTipos));
+    }
+#endif
+
+    if (total > 0)
+    {
+        int emOrdem = validarItens(itens, total, (cabecalho.flags & SNAPSHOT_ORDENADO) != 0);
+        if (emOrdem < 0)
+        {
+#ifdef _WIN32
+            free(itens);
+#else
+            desmapearVetor();
+#endif
+            totalTipos = 0; // o dicionário volta a ficar vazio, como o vetor
+            return -1;
+        }
+
+        mochilaVetor = itens;
+        capacidadeVetor = (int)total;
+        totalItensVetor = (int)total;
+        vetorOrdenado = emOrdem || total <= 1;
+    }
+    return 1;
+}
+
+/*
+ * Função: salvarSnapshot
+ * Descrição: grava os itens do vetor no formato de snapshot
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se sucesso, 0 se não foi possível gravar
+ *
+ * Escreve em "caminho.tmp", força os dados para o disco e só então
+ * renomeia, para que uma queda no meio deixe o snapshot anterior
+ * intacto. Os registros são zerados antes de preenchidos (arquivo
+ * determinístico e nomes sempre terminados). O dicionário vai inteiro,
+ * com os números de tipo que os registros usam.
+ */
+int salvarSnapshot(const char *caminho)
+{
+    char temporario[FILENAME_MAX];
+    static Item bloco[REGISTROS_POR_ESCRITA];
+
+    if (snprintf(temporario, sizeof(temporario), "%s.tmp", caminho) >= (int)sizeof(temporario))
+    {
+        return 0;
+    }
+
+    FILE *arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL)
+    {
+        return 0;
+    }
+
+    CabecalhoSnapshot cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho.assinatura));
+    cabecalho.versao = VERSAO_SNAPSHOT;
+    cabecalho.ordemBytes = MARCA_ORDEM_BYTES;
+    cabecalho.tamanhoRegistro = sizeof(Item);
+    cabecalho.flags = vetorOrdenado ? SNAPSHOT_ORDENADO : 0;
+    cabecalho.totalTipos = (unsigned int)totalTipos;
+    cabecalho.tamanhoTipo = TAMANHO_TIPO;
+    cabecalho.totalRegistros = (unsigned long long)totalItensVetor;
+
+    static const char zeros[8];
+    size_t bytesTipos = (size_t)totalTipos * TAMANHO_TIPO;
+    size_t preenchimento = (size_t)bytesDoDicionario((unsigned int)totalTipos) - bytesTipos;
+
+    int sucesso = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 &&
+                  fwrite(nomesTipos, 1, bytesTipos, arquivo) == bytesTipos &&
+                  fwrite(zeros, 1, preenchimento, arquivo) == preenchimento;
+    int noBloco = 0;
+
+    for (int i = 0; sucesso && i < totalItensVetor; i++)
+    {
+        Item *registro = &bloco[noBloco];
+        memset(registro, 0, sizeof(*registro));
+        memcpy(registro->nome, mochilaVetor[i].nome, strnlen(mochilaVetor[i].nome, sizeof(registro->nome) - 1));
+        registro->tipo = mochilaVetor[i].tipo;
+        registro->quantidade = mochilaVetor[i].quantidade;
+
+        if (++noBloco == REGISTROS_POR_ESCRITA)
+        {
+            sucesso = fwrite(bloco, sizeof(Item), (size_t)noBloco, arquivo) == (size_t)noBloco;
+            noBloco = 0;
+        }
+    }
+
+    if (sucesso && noBloco > 0)
+    {
+        sucesso = fwrite(bloco, sizeof(Item), (size_t)noBloco, arquivo) == (size_t)noBloco;
+    }
+
+    sucesso = sucesso && fflush(arquivo) == 0;
+#ifndef _WIN32
+    sucesso = sucesso && fsync(fileno(arquivo)) == 0;
+#endif
+    if (fclose(arquivo) != 0)
+    {
+        sucesso = 0;
+    }
+
+#ifdef _WIN32
+    if (sucesso)
+    {
+        remove(caminho); // rename não substitui arquivos no Windows
+    }
+#endif
+
+    if (!sucesso || rename(temporario, caminho) != 0)
+    {
+        remove(temporario);
+        return 0;
+    }
+    return 1;
+}
+
+/* ========================================
+ * FUNÇÕES - VETOR (Lista Sequencial)
+ * ======================================== */
+
+/*
+ * Função: garantirEspacoVetor
+ * Descrição: garante lugar para mais um item, dobrando a capacidade
+ * Parâmetros: nenhum
+ * Retorno: 1 se há espaço, 0 se faltou memória
+ *
+ * Custo amortizado O(1) por inserção. Um vetor ainda mapeado de um
+ * snapshot é copiado para o heap na primeira vez que precisa crescer.
+ */
+int garantirEspacoVetor()
+{
+    if (totalItensVetor < capacidadeVetor)
     {
-        No *temp = mochilaLista;
-        mochilaLista = mochilaLista->proximo;
-        free(temp);
-        totalItensLista--;
         return 1;
     }
 
-    // Procura nos próximos nós
-    No *atual = mochilaLista;
-    while (atual->proximo != NULL)
+    int novaCapacidade = (capacidadeVetor == 0) ? MAX_ITENS : capacidadeVetor * 2;
+    Item *novoVetor;
+
+    if (regiaoMapeada != NULL)
     {
-        if (strcmp(atual->proximo->dados.nome, nome) == 0)
+        novoVetor = (Item *)malloc(novaCapacidade * sizeof(Item));
+        if (novoVetor == NULL)
         {
-            No *temp = atual->proximo;
-            atual->proximo = temp->proximo;
-            free(temp);
-            totalItensLista--;
-            return 1;
+            return 0;
+        }
+        memcpy(novoVetor, mochilaVetor, totalItensVetor * sizeof(Item));
+        desmapearVetor();
+    }
+    else
+    {
+        novoVetor = (Item *)realloc(mochilaVetor, novaCapacidade * sizeof(Item));
+        if (novoVetor == NULL)
+        {
+            return 0;
         }
-        atual = atual->proximo;
     }
 
-    return 0;
+    mochilaVetor = novoVetor;
+    capacidadeVetor = novaCapacidade;
+    return 1;
 }
 
 /*
- * Função: listarItensLista
- * Descrição: exibe todos os itens da lista em formato tabular
+ * Função: liberarVetor
+ * Descrição: libera a memória do vetor
  * Parâmetros: nenhum
  * Retorno: nenhum
  */
-void listarItensLista()
+void liberarVetor()
 {
-    printf("\n%s\n", LINHA);
-    printf("      📦 ITENS DO INVENTÁRIO (LISTA) 📦\n");
-    printf("%s\n", LINHA);
+    if (regiaoMapeada != NULL)
+    {
+        desmapearVetor();
+    }
+    else
+    {
+        free(mochilaVetor);
+    }
+    mochilaVetor = NULL;
+    capacidadeVetor = 0;
+    totalItensVetor = 0;
+    vetorOrdenado = 1;
+}
 
-    if (mochilaLista == NULL)
+/*
+ * Função: posicaoOrdenadaVetor
+ * Descrição: busca binária pela posição onde o nome deve entrar
+ * Parâmetros: nome do item
+ * Retorno: índice do primeiro item com nome maior que o dado
+ *
+ * Precondição: vetor ORDENADO
+ * Empates vão para depois dos iguais (inserção estável).
+ */
+int posicaoOrdenadaVetor(const char *nome)
+{
+    int esquerda = 0;
+    int direita = totalItensVetor;
+
+    comparacoesInsercaoVetor = 0;
+
+    while (esquerda < direita)
     {
-        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
-        printf("%s\n\n", LINHA);
-        return;
+        int meio = (esquerda + direita) / 2;
+
+        comparacoesInsercaoVetor++;
+        if (strcmp(mochilaVetor[meio].nome, nome) <= 0)
+        {
+            esquerda = meio + 1;
+        }
+        else
+        {
+            direita = meio;
+        }
     }
 
-    printf("Total de itens: %d/%d\n\n", totalItensLista, MAX_ITENS);
+    return esquerda;
+}
+
+/*
+ * Função: inserirItemVetor
+ * Descrição: adiciona um novo item no vetor
+ * Parâmetros: nome, tipo, quantidade do item
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * No modo ordenado a posição vem da busca binária e os itens
+ * seguintes são deslocados de uma vez com memmove: O(log n)
+ * comparações + O(n) cópia. Fora dele o item vai para o final e só
+ * se verifica se a ordem foi quebrada.
+ */
+int inserirItemVetor(const char *nome, const char *tipo, int quantidade)
+{
+    int numeroTipo = internarTipo(tipo);
 
-    printf("┌────┬──────────────────────────┬────────────────┬────────────┐\n");
-    printf("│ #  │ Nome do Item             │ Tipo           │ Quantidade │\n");
-    printf("├────┼──────────────────────────┼────────────────┼────────────┤\n");
+    if (numeroTipo == -1 || !garantirEspacoVetor())
+    {
+        return 0;
+    }
 
-    No *atual = mochilaLista;
-    int contador = 1;
+    int posicao = totalItensVetor;
 
-    while (atual != NULL)
+    if (modoVetorOrdenado)
     {
-        printf("│ %2d │ %-24s │ %-14s │ %10d │\n",
-               contador,
-               atual->dados.nome,
-               atual->dados.tipo,
-               atual->dados.quantidade);
-        atual = atual->proximo;
-        contador++;
+        posicao = posicaoOrdenadaVetor(nome);
+        memmove(&mochilaVetor[posicao + 1], &mochilaVetor[posicao],
+                (totalItensVetor - posicao) * sizeof(Item));
+    }
+    else if (totalItensVetor > 0 && strcmp(mochilaVetor[totalItensVetor - 1].nome, nome) > 0)
+    {
+        vetorOrdenado = 0;
     }
 
-    printf("└────┴──────────────────────────┴────────────────┴────────────┘\n");
-    printf("\n");
+    strcpy(mochilaVetor[posicao].nome, nome);
+    mochilaVetor[posicao].tipo = (unsigned char)numeroTipo;
+    mochilaVetor[posicao].quantidade = quantidade;
+
+    totalItensVetor++;
+    vetorAlterado = 1;
+    return 1;
 }
 
 /*
- * Função: buscarSequencialLista
- * Descrição: busca item na lista sequencialmente e conta comparações
- * Parâmetros: nome do item
- * Retorno: ponteiro para o nó encontrado ou NULL
+ * Função: removerItemVetor
+ * Descrição: remove um item do vetor pelo nome
+ * Parâmetros: nome do item a remover
+ * Retorno: 1 se sucesso, 0 se falhou
  */
-No *buscarSequencialLista(const char *nome)
+int removerItemVetor(const char *nome)
 {
-    comparacoesSequencialLista = 0;
-    No *atual = mochilaLista;
+    int indice = -1;
 
-    while (atual != NULL)
+    // Busca sequencial do item
+    for (int i = 0; i < totalItensVetor; i++)
     {
-        comparacoesSequencialLista++;
-        if (strcmp(atual->dados.nome, nome) == 0)
+        if (strcmp(mochilaVetor[i].nome, nome) == 0)
         {
-            return atual;
+            indice = i;
+            break;
         }
-        atual = atual->proximo;
     }
 
-    return NULL;
+    if (indice == -1)
+    {
+        return 0;
+    }
+
+    // Remove o item deslocando os posteriores (mantém a ordem)
+    memmove(&mochilaVetor[indice], &mochilaVetor[indice + 1],
+            (totalItensVetor - indice - 1) * sizeof(Item));
+
+    totalItensVetor--;
+    vetorAlterado = 1;
+    if (totalItensVetor <= 1)
+    {
+        vetorOrdenado = 1; // Zero ou um item estão sempre em ordem
+    }
+    return 1;
+}
+
+/*
+ * Função: listarPaginaVetor
+ * Descrição: exibe uma página da tabela do vetor com uma única escrita
+ * Parâmetros: índice do primeiro item e máximo de itens
+ * Retorno: nenhum
+ */
+void listarPaginaVetor(int inicio, int limite)
+{
+    anexarCabecalhoTabela(inicio, limite, totalItensVetor);
+
+    for (int i = inicio; i < totalItensVetor && i < inicio + limite; i++)
+    {
+        anexarLinhaTabela(i + 1, &mochilaVetor[i]);
+    }
+
+    fecharTabela();
 }
 
-/*
- * Função: liberarLista
- * Descrição: libera toda a memória alocada pela lista
- * Parâmetros: nenhum
- * Retorno: nenhum
- *
- * Importante: deve ser chamada ao sair do programa
- */
-void liberarLista()
-{
-    No *atual = mochilaLista;
+/*
+ * Função: exibirItensVetor
+ * Descrição: exibe os itens do vetor em formato tabular, paginado
+ * Parâmetros: 1 para paginar interativamente, 0 para só a primeira página
+ * Retorno: nenhum
+ */
+void exibirItensVetor(int interativo)
+{
+    printf("\n%s\n", LINHA);
+    printf("           📦 ITENS DO INVENTÁRIO (VETOR) 📦\n");
+    printf("%s\n", LINHA);
+
+    if (totalItensVetor == 0)
+    {
+        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Total de itens: ");
+    exibirContagem(totalItensVetor);
+    printf("\n");
+    paginarTabela(totalItensVetor, listarPaginaVetor, interativo);
+}
+
+/*
+ * Função: listarItensVetor
+ * Descrição: exibe todos os itens do vetor, página a página
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void listarItensVetor()
+{
+    exibirItensVetor(1);
+}
+
+/*
+ * Função: buscarSequencialVetor
+ * Descrição: busca item no vetor sequencialmente e conta comparações
+ * Parâmetros: nome do item
+ * Retorno: índice do item ou -1 se não encontrado
+ */
+int buscarSequencialVetor(const char *nome)
+{
+    comparacoesSequencialVetor = 0;
+
+    for (int i = 0; i < totalItensVetor; i++)
+    {
+        comparacoesSequencialVetor++;
+        if (strcmp(mochilaVetor[i].nome, nome) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * Ordenação do vetor: Introsort
+ * ----------------------------------------
+ * Quick Sort com pivô pela mediana de três faz o trabalho pesado.
+ * Se a recursão passar de 2·log2(n) níveis (pivôs ruins em sequência)
+ * o trecho é entregue ao Heap Sort, o que garante O(n log n) no pior
+ * caso. Trechos com até LIMIAR_INSERCAO itens ficam para uma passada
+ * final de Insertion Sort, que é mais rápida em blocos pequenos.
+ *
+ * Todas as comparações passam por compararItensPorNome, que alimenta
+ * comparacoesOrdenacaoVetor.
+ */
+
+#define LIMIAR_INSERCAO 16
+
+/*
+ * Função: compararItensPorNome
+ * Descrição: compara dois itens pelo nome e conta a comparação
+ * Parâmetros: ponteiros para os dois itens
+ * Retorno: <0, 0 ou >0, como strcmp
+ */
+int compararItensPorNome(const Item *a, const Item *b)
+{
+    comparacoesOrdenacaoVetor++;
+    return strcmp(a->nome, b->nome);
+}
+
+/*
+ * Função: trocarItens
+ * Descrição: troca o conteúdo de dois itens
+ * Parâmetros: ponteiros para os dois itens
+ * Retorno: nenhum
+ */
+void trocarItens(Item *a, Item *b)
+{
+    Item temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+/*
+ * Função: ordenarPorInsercao (Insertion Sort)
+ * Descrição: ordena um trecho pequeno ou quase ordenado
+ * Parâmetros: início do trecho e quantidade de itens
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²) no geral, O(n) se o trecho já está ordenado
+ */
+void ordenarPorInsercao(Item *itens, int quantidade)
+{
+    for (int i = 1; i < quantidade; i++)
+    {
+        Item chave = itens[i];
+        int j = i - 1;
+
+        while (j >= 0 && compararItensPorNome(&itens[j], &chave) > 0)
+        {
+            itens[j + 1] = itens[j];
+            j--;
+        }
+        itens[j + 1] = chave;
+    }
+}
+
+/*
+ * Função: afundarHeap
+ * Descrição: desce um item no heap até restaurar a propriedade de máximo
+ * Parâmetros: heap, tamanho do heap e posição do item
+ * Retorno: nenhum
+ */
+void afundarHeap(Item *itens, int tamanho, int raiz)
+{
+    while (1)
+    {
+        int maior = raiz;
+        int esquerda = 2 * raiz + 1;
+        int direita = esquerda + 1;
+
+        if (esquerda < tamanho && compararItensPorNome(&itens[esquerda], &itens[maior]) > 0)
+        {
+            maior = esquerda;
+        }
+        if (direita < tamanho && compararItensPorNome(&itens[direita], &itens[maior]) > 0)
+        {
+            maior = direita;
+        }
+
+        if (maior == raiz)
+        {
+            return;
+        }
+
+        trocarItens(&itens[raiz], &itens[maior]);
+        raiz = maior;
+    }
+}
+
+/*
+ * Função: ordenarPorHeap (Heap Sort)
+ * Descrição: ordena um trecho com heap de máximo
+ * Parâmetros: início do trecho e quantidade de itens
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n log n) sempre (rede de segurança do Introsort)
+ */
+void ordenarPorHeap(Item *itens, int quantidade)
+{
+    for (int i = quantidade / 2 - 1; i >= 0; i--)
+    {
+        afundarHeap(itens, quantidade, i);
+    }
+
+    for (int fim = quantidade - 1; fim > 0; fim--)
+    {
+        trocarItens(&itens[0], &itens[fim]);
+        afundarHeap(itens, fim, 0);
+    }
+}
+
+/*
+ * Função: particionarItens
+ * Descrição: particiona o trecho em torno da mediana de três (Hoare)
+ * Parâmetros: início do trecho e quantidade de itens (> 2)
+ * Retorno: tamanho da parte da esquerda (entre 1 e quantidade - 1)
+ *
+ * Ao final, todo item da esquerda tem nome <= a todo item da direita.
+ */
+int particionarItens(Item *itens, int quantidade)
+{
+    int meio = (quantidade - 1) / 2;
+    int ultimo = quantidade - 1;
+
+    // Mediana de três: itens[0] <= itens[meio] <= itens[ultimo]
+    if (compararItensPorNome(&itens[meio], &itens[0]) < 0)
+    {
+        trocarItens(&itens[meio], &itens[0]);
+    }
+    if (compararItensPorNome(&itens[ultimo], &itens[0]) < 0)
+    {
+        trocarItens(&itens[ultimo], &itens[0]);
+    }
+    if (compararItensPorNome(&itens[ultimo], &itens[meio]) < 0)
+    {
+        trocarItens(&itens[ultimo], &itens[meio]);
+    }
+
+    Item pivo = itens[meio];
+    int i = -1;
+    int j = quantidade;
+
+    while (1)
+    {
+        do
+        {
+            i++;
+        } while (compararItensPorNome(&itens[i], &pivo) < 0);
+
+        do
+        {
+            j--;
+        } while (compararItensPorNome(&itens[j], &pivo) > 0);
+
+        if (i >= j)
+        {
+            return j + 1;
+        }
+
+        trocarItens(&itens[i], &itens[j]);
+    }
+}
+
+/*
+ * Função: introsortItens
+ * Descrição: Quick Sort com limite de profundidade (parte recursiva)
+ * Parâmetros: início do trecho, quantidade e profundidade restante
+ * Retorno: nenhum
+ *
+ * Recursão só na parte menor: a pilha fica em O(log n).
+ * Trechos pequenos são deixados para a passada de Insertion Sort.
+ */
+void introsortItens(Item *itens, int quantidade, int profundidade)
+{
+    while (quantidade > LIMIAR_INSERCAO)
+    {
+        if (profundidade == 0)
+        {
+            ordenarPorHeap(itens, quantidade);
+            return;
+        }
+        profundidade--;
+
+        int corte = particionarItens(itens, quantidade);
+
+        if (corte < quantidade - corte)
+        {
+            introsortItens(itens, corte, profundidade);
+            itens += corte;
+            quantidade -= corte;
+        }
+        else
+        {
+            introsortItens(itens + corte, quantidade - corte, profundidade);
+            quantidade = corte;
+        }
+    }
+}
+
+/*
+ * Função: ordenarItens (Introsort)
+ * Descrição: ordena um vetor de itens alfabeticamente por nome
+ * Parâmetros: vetor de itens e quantidade
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n log n) no pior caso
+ */
+void ordenarItens(Item *itens, int quantidade)
+{
+    int profundidade = 0;
+
+    for (int n = quantidade; n > 1; n /= 2)
+    {
+        profundidade += 2;
+    }
+
+    introsortItens(itens, quantidade, profundidade);
+
+    // Cada item está a menos de LIMIAR_INSERCAO posições do lugar final
+    ordenarPorInsercao(itens, quantidade);
+}
+
+/*
+ * Função: ordenarVetor (Introsort)
+ * Descrição: ordena os itens do vetor alfabeticamente por nome
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n log n)
+ * Registra as comparações em comparacoesOrdenacaoVetor
+ */
+void ordenarVetor()
+{
+    printf("\n⏳ Ordenando itens (Introsort)...\n");
+
+    comparacoesOrdenacaoVetor = 0;
+    ordenarItens(mochilaVetor, totalItensVetor);
+    vetorOrdenado = 1;
+    vetorAlterado = 1;
+
+    printf("✅ Itens ordenados alfabeticamente!\n");
+}
+
+/*
+ * Função: ativarModoOrdenado
+ * Descrição: liga ou desliga o modo "sempre ordenado" do vetor
+ * Parâmetros: 1 para ligar, 0 para desligar
+ * Retorno: nenhum
+ *
+ * Ao ligar, ordena uma única vez se o vetor estiver fora de ordem;
+ * daí em diante nenhuma reordenação completa é necessária.
+ */
+void ativarModoOrdenado(int ativo)
+{
+    if (ativo && !vetorOrdenado)
+    {
+        ordenarVetor();
+    }
+
+    modoVetorOrdenado = ativo;
+}
+
+/*
+ * Função: buscarBinariaVetor
+ * Descrição: busca item no vetor ordenado usando busca binária
+ * Parâmetros: nome do item
+ * Retorno: índice do item ou -1 se não encontrado
+ *
+ * Precondição: vetor deve estar ORDENADO (vetorOrdenado); caso
+ * contrário retorna -1 sem buscar, em vez de uma resposta errada
+ * Complexidade: O(log n)
+ */
+int buscarBinariaVetor(const char *nome)
+{
+    comparacoesBinariaVetor = 0;
+
+    if (!vetorOrdenado)
+    {
+        return -1;
+    }
+    int esquerda = 0;
+    int direita = totalItensVetor - 1;
+
+    while (esquerda <= direita)
+    {
+        comparacoesBinariaVetor++;
+        int meio = (esquerda + direita) / 2;
+        int comparacao = strcmp(mochilaVetor[meio].nome, nome);
+
+        if (comparacao == 0)
+        {
+            return meio; // Encontrado!
+        }
+        else if (comparacao < 0)
+        {
+            esquerda = meio + 1; // Procura na metade direita
+        }
+        else
+        {
+            direita = meio - 1; // Procura na metade esquerda
+        }
+    }
+
+    return -1; // Não encontrado
+}
+
+/* ========================================
+ * POOL DE NÓS DA LISTA
+ * ========================================
+ *
+ * Em vez de um malloc por nó, os nós são retirados de blocos de
+ * NOS_POR_BLOCO posições. Nós removidos voltam para uma lista de
+ * livres e são reaproveitados. Liberar a lista inteira custa um free
+ * por bloco, sem percorrer nó a nó.
+ */
+
+#define NOS_POR_BLOCO 256
+
+typedef struct BlocoNos
+{
+    struct BlocoNos *proximo;
+    No nos[NOS_POR_BLOCO];
+} BlocoNos;
+
+typedef struct
+{
+    BlocoNos *blocos; // Blocos alocados (o primeiro é o mais recente)
+    int usadosBloco;  // Nós já entregues do bloco mais recente
+    No *livres;       // Nós devolvidos, encadeados por 'proximo'
+} PoolNos;
+
+PoolNos poolLista = {NULL, NOS_POR_BLOCO, NULL};
+
+/*
+ * Função: alocarNo
+ * Descrição: retira um nó do pool (reaproveitado ou de um bloco)
+ * Parâmetros: pool
+ * Retorno: ponteiro para o nó ou NULL se faltou memória
+ */
+No *alocarNo(PoolNos *pool)
+{
+    if (pool->livres != NULL)
+    {
+        No *no = pool->livres;
+        pool->livres = no->proximo;
+        return no;
+    }
+
+    if (pool->usadosBloco == NOS_POR_BLOCO)
+    {
+        BlocoNos *bloco = (BlocoNos *)malloc(sizeof(BlocoNos));
+        if (bloco == NULL)
+        {
+            return NULL;
+        }
+        bloco->proximo = pool->blocos;
+        pool->blocos = bloco;
+        pool->usadosBloco = 0;
+    }
+
+    return &pool->blocos->nos[pool->usadosBloco++];
+}
+
+/*
+ * Função: devolverNo
+ * Descrição: devolve um nó ao pool para ser reaproveitado
+ * Parâmetros: pool, nó
+ * Retorno: nenhum
+ */
+void devolverNo(PoolNos *pool, No *no)
+{
+    no->proximo = pool->livres;
+    pool->livres = no;
+}
+
+/*
+ * Função: liberarPool
+ * Descrição: libera todos os blocos do pool de uma vez
+ * Parâmetros: pool
+ * Retorno: nenhum
+ *
+ * Complexidade: um free por bloco (n / NOS_POR_BLOCO), sem visitar os nós
+ */
+void liberarPool(PoolNos *pool)
+{
+    while (pool->blocos != NULL)
+    {
+        BlocoNos *proximo = pool->blocos->proximo;
+        free(pool->blocos);
+        pool->blocos = proximo;
+    }
+
+    pool->usadosBloco = NOS_POR_BLOCO;
+    pool->livres = NULL;
+}
+
+/* ========================================
+ * FUNÇÕES - LISTA ENCADEADA
+ * ======================================== */
+
+/*
+ * Função: criarNo
+ * Descrição: cria um novo nó para a lista encadeada
+ * Parâmetros: nome, tipo, quantidade do item
+ * Retorno: ponteiro para o novo nó
+ *
+ * O nó vem do pool da mochila (poolLista).
+ */
+No *criarNo(const char *nome, const char *tipo, int quantidade)
+{
+    int numeroTipo = internarTipo(tipo);
+
+    if (numeroTipo == -1)
+    {
+        return NULL;
+    }
+
+    No *novoNo = alocarNo(&poolLista);
+
+    if (novoNo == NULL)
+    {
+        printf("❌ Erro ao alocar memória!\n");
+        return NULL;
+    }
+
+    strcpy(novoNo->dados.nome, nome);
+    novoNo->dados.tipo = (unsigned char)numeroTipo;
+    novoNo->dados.quantidade = quantidade;
+    novoNo->proximo = NULL;
+
+    return novoNo;
+}
+
+/*
+ * Função: inserirItemLista
+ * Descrição: insere um novo item no final da lista encadeada
+ * Parâmetros: nome, tipo, quantidade do item
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * Complexidade: O(1) - usa o ponteiro de cauda
+ */
+int inserirItemLista(const char *nome, const char *tipo, int quantidade)
+{
+    No *novoNo = criarNo(nome, tipo, quantidade);
+
+    if (novoNo == NULL)
+    {
+        return 0;
+    }
+
+    if (mochilaLista == NULL)
+    {
+        mochilaLista = novoNo;
+    }
+    else
+    {
+        caudaLista->proximo = novoNo;
+    }
+    caudaLista = novoNo;
+
+    totalItensLista++;
+    return 1;
+}
+
+/*
+ * Função: removerItemLista
+ * Descrição: remove um item da lista pelo nome
+ * Parâmetros: nome do item a remover
+ * Retorno: 1 se sucesso, 0 se falhou
+ */
+int removerItemLista(const char *nome)
+{
+    if (mochilaLista == NULL)
+    {
+        return 0;
+    }
+
+    // Se é o primeiro nó
+    if (strcmp(mochilaLista->dados.nome, nome) == 0)
+    {
+        No *temp = mochilaLista;
+        mochilaLista = mochilaLista->proximo;
+        if (caudaLista == temp)
+        {
+            caudaLista = NULL;
+        }
+        devolverNo(&poolLista, temp);
+        totalItensLista--;
+        return 1;
+    }
+
+    // Procura nos próximos nós
+    No *atual = mochilaLista;
+    while (atual->proximo != NULL)
+    {
+        if (strcmp(atual->proximo->dados.nome, nome) == 0)
+        {
+            No *temp = atual->proximo;
+            atual->proximo = temp->proximo;
+            if (caudaLista == temp)
+            {
+                caudaLista = atual;
+            }
+            devolverNo(&poolLista, temp);
+            totalItensLista--;
+            return 1;
+        }
+        atual = atual->proximo;
+    }
+
+    return 0;
+}
+
+/*
+ * Função: listarPaginaLista
+ * Descrição: exibe uma página da tabela da lista com uma única escrita
+ * Parâmetros: ordem do primeiro item e máximo de itens
+ * Retorno: nenhum
+ *
+ * Chegar ao primeiro item da página custa O(inicio): lista não tem
+ * acesso direto por índice.
+ */
+void listarPaginaLista(int inicio, int limite)
+{
+    No *atual = mochilaLista;
+    for (int i = 0; i < inicio && atual != NULL; i++)
+    {
+        atual = atual->proximo;
+    }
+
+    anexarCabecalhoTabela(inicio, limite, totalItensLista);
+
+    int contador = inicio + 1;
+    while (atual != NULL && limite-- > 0)
+    {
+        anexarLinhaTabela(contador, &atual->dados);
+        atual = atual->proximo;
+        contador++;
+    }
+
+    fecharTabela();
+}
+
+/*
+ * Função: exibirItensLista
+ * Descrição: exibe os itens da lista em formato tabular, paginado
+ * Parâmetros: 1 para paginar interativamente, 0 para só a primeira página
+ * Retorno: nenhum
+ */
+void exibirItensLista(int interativo)
+{
+    printf("\n%s\n", LINHA);
+    printf("      📦 ITENS DO INVENTÁRIO (LISTA) 📦\n");
+    printf("%s\n", LINHA);
+
+    if (mochilaLista == NULL)
+    {
+        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Total de itens: ");
+    exibirContagem(totalItensLista);
+    printf("\n");
+    paginarTabela(totalItensLista, listarPaginaLista, interativo);
+}
+
+/*
+ * Função: listarItensLista
+ * Descrição: exibe todos os itens da lista, página a página
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void listarItensLista()
+{
+    exibirItensLista(1);
+}
+
+/*
+ * Função: buscarSequencialLista
+ * Descrição: busca item na lista sequencialmente e conta comparações
+ * Parâmetros: nome do item
+ * Retorno: ponteiro para o nó encontrado ou NULL
+ */
+No *buscarSequencialLista(const char *nome)
+{
+    comparacoesSequencialLista = 0;
+    No *atual = mochilaLista;
+
+    while (atual != NULL)
+    {
+        comparacoesSequencialLista++;
+        if (strcmp(atual->dados.nome, nome) == 0)
+        {
+            return atual;
+        }
+        atual = atual->proximo;
+    }
+
+    return NULL;
+}
+
+/*
+ * Função: intercalarListas
+ * Descrição: intercala duas listas ordenadas em uma só
+ * Parâmetros: lista da esquerda e lista da direita (ambas ordenadas)
+ * Retorno: primeiro nó da lista intercalada
+ *
+ * Só religa ponteiros: nenhum Item é copiado. Em caso de empate o nó
+ * da esquerda vem primeiro, o que mantém a ordenação estável.
+ */
+No *intercalarListas(No *esquerda, No *direita)
+{
+    No *resultado = NULL;
+    No **fim = &resultado;
+
+    while (esquerda != NULL && direita != NULL)
+    {
+        comparacoesOrdenacaoLista++;
+        if (strcmp(direita->dados.nome, esquerda->dados.nome) < 0)
+        {
+            *fim = direita;
+            direita = direita->proximo;
+        }
+        else
+        {
+            *fim = esquerda;
+            esquerda = esquerda->proximo;
+        }
+        fim = &(*fim)->proximo;
+    }
+
+    *fim = (esquerda != NULL) ? esquerda : direita;
+    return resultado;
+}
+
+/*
+ * Função: ordenarLista (Merge Sort bottom-up)
+ * Descrição: ordena os itens da lista alfabeticamente por nome
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n log n), sem recursão e sem memória extra por item
+ * Estratégia: niveis[i] guarda uma sublista ordenada de 2^i nós. Cada
+ * nó retirado da lista é intercalado com os níveis ocupados, como
+ * o "vai um" de uma soma binária; no fim os níveis são juntados.
+ */
+#define NIVEIS_MERGE 48
+
+void ordenarLista()
+{
+    No *niveis[NIVEIS_MERGE] = {NULL};
+    No *atual = mochilaLista;
+
+    comparacoesOrdenacaoLista = 0;
+
+    while (atual != NULL)
+    {
+        No *carga = atual;
+        atual = atual->proximo;
+        carga->proximo = NULL;
+
+        int i = 0;
+        while (i < NIVEIS_MERGE - 1 && niveis[i] != NULL)
+        {
+            // niveis[i] contém nós mais antigos: vai à esquerda
+            carga = intercalarListas(niveis[i], carga);
+            niveis[i] = NULL;
+            i++;
+        }
+        niveis[i] = carga;
+    }
+
+    No *resultado = NULL;
+    for (int i = 0; i < NIVEIS_MERGE; i++)
+    {
+        if (niveis[i] != NULL)
+        {
+            resultado = intercalarListas(niveis[i], resultado);
+        }
+    }
+
+    // Reajusta cabeça e cauda
+    mochilaLista = resultado;
+    caudaLista = resultado;
+    while (caudaLista != NULL && caudaLista->proximo != NULL)
+    {
+        caudaLista = caudaLista->proximo;
+    }
+}
+
+/*
+ * Função: liberarLista
+ * Descrição: libera toda a memória alocada pela lista
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Importante: deve ser chamada ao sair do programa
+ * Complexidade: um free por bloco do pool, sem percorrer os nós
+ */
+void liberarLista()
+{
+    liberarPool(&poolLista);
+
+    mochilaLista = NULL;
+    caudaLista = NULL;
+    totalItensLista = 0;
+}
+
+/* ========================================
+ * MEDIÇÃO DE INSERÇÃO EM MASSA NA LISTA
+ * ========================================
+ *
+ * Constrói listas temporárias com N itens sintéticos de duas formas e
+ * compara o tempo: a original (procura o último nó e faz um malloc por
+ * item, O(n²) no total) e a atual (ponteiro de cauda + pool, O(n)).
+ */
+
+/*
+ * Função: construirListaOriginal
+ * Descrição: insere N itens percorrendo a lista até o fim a cada inserção
+ * Parâmetros: quantidade de itens, número do tipo sintético
+ * Retorno: cabeça da lista construída (liberar com free nó a nó)
+ */
+No *construirListaOriginal(int quantidade, unsigned char tipoSintetico)
+{
+    No *cabeca = NULL;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        No *novoNo = (No *)malloc(sizeof(No));
+        if (novoNo == NULL)
+        {
+            break;
+        }
+        snprintf(novoNo->dados.nome, sizeof(novoNo->dados.nome), "item%07d", i);
+        novoNo->dados.tipo = tipoSintetico;
+        novoNo->dados.quantidade = 1;
+        novoNo->proximo = NULL;
+
+        if (cabeca == NULL)
+        {
+            cabeca = novoNo;
+        }
+        else
+        {
+            No *atual = cabeca;
+            while (atual->proximo != NULL)
+            {
+                atual = atual->proximo;
+            }
+            atual->proximo = novoNo;
+        }
+    }
+
+    return cabeca;
+}
+
+/*
+ * Função: construirListaComPool
+ * Descrição: insere N itens usando ponteiro de cauda e pool de nós
+ * Parâmetros: quantidade de itens, pool de onde saem os nós, número do tipo sintético
+ * Retorno: cabeça da lista construída (liberar com liberarPool)
+ */
+No *construirListaComPool(int quantidade, PoolNos *pool, unsigned char tipoSintetico)
+{
+    No *cabeca = NULL;
+    No *cauda = NULL;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        No *novoNo = alocarNo(pool);
+        if (novoNo == NULL)
+        {
+            break;
+        }
+        snprintf(novoNo->dados.nome, sizeof(novoNo->dados.nome), "item%07d", i);
+        novoNo->dados.tipo = tipoSintetico;
+        novoNo->dados.quantidade = 1;
+        novoNo->proximo = NULL;
+
+        if (cabeca == NULL)
+        {
+            cabeca = novoNo;
+        }
+        else
+        {
+            cauda->proximo = novoNo;
+        }
+        cauda = novoNo;
+    }
+
+    return cabeca;
+}
+
+/*
+ * Função: medirInsercaoEmMassa
+ * Descrição: compara a vazão de inserção dos dois métodos
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void medirInsercaoEmMassa()
+{
+    printf("\n%s\n", LINHA);
+    printf("   ⚡ INSERÇÃO EM MASSA: ORIGINAL x CAUDA + POOL ⚡\n");
+    printf("%s\n", LINHA);
+
+    int quantidade;
+    printf("Quantos itens inserir (ex: 20000)? ");
+    scanf("%d", &quantidade);
+    getchar();
+
+    if (quantidade <= 0)
+    {
+        printf("❌ Erro: a quantidade deve ser maior que zero!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    if (quantidade > 100000)
+    {
+        printf("⚠️  O método original é O(n²): para %d itens pode levar minutos.\n", quantidade);
+    }
+
+    // Os itens sintéticos usam um dicionário à parte
+    guardarTipos();
+    int tipoSintetico = internarTipo("sintetico");
+    if (tipoSintetico == -1)
+    {
+        restaurarTipos();
+        printf("❌ Erro: não foi possível criar o tipo dos itens sintéticos!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("\n⏳ Método original (percorre até o fim + malloc por nó)...\n");
+    clock_t inicio = clock();
+    No *listaOriginal = construirListaOriginal(quantidade, (unsigned char)tipoSintetico);
+    double tempoOriginal = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+
+    while (listaOriginal != NULL)
+    {
+        No *temp = listaOriginal;
+        listaOriginal = listaOriginal->proximo;
+        free(temp);
+    }
+
+    printf("⏳ Método atual (ponteiro de cauda + pool de nós)...\n");
+    PoolNos poolTeste = {NULL, NOS_POR_BLOCO, NULL};
+    inicio = clock();
+    construirListaComPool(quantidade, &poolTeste, (unsigned char)tipoSintetico);
+    double tempoPool = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    liberarPool(&poolTeste);
+    restaurarTipos();
+
+    printf("\n📊 RESULTADO PARA %d ITENS:\n", quantidade);
+    printf("   Original:      %.6f s", tempoOriginal);
+    if (tempoOriginal > 0)
+    {
+        printf("  (%.0f inserções/s)", quantidade / tempoOriginal);
+    }
+    printf("\n   Cauda + pool:  %.6f s", tempoPool);
+    if (tempoPool > 0)
+    {
+        printf("  (%.0f inserções/s)", quantidade / tempoPool);
+    }
+    printf("\n");
+
+    if (tempoPool > 0)
+    {
+        printf("   Aceleração: %.1fx\n", tempoOriginal / tempoPool);
+    }
+    else
+    {
+        printf("   Aceleração: tempo do método atual abaixo da resolução do relógio\n");
+    }
+
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * BENCHMARK VETOR x LISTA
+ * ========================================
+ *
+ * Gera N itens sintéticos (N = 10, 100, ... até o máximo pedido) e
+ * mede, com relógio monotônico em nanossegundos, as operações de
+ * cada estrutura: inserir, busca sequencial, ordenar, busca binária
+ * (só vetor) e remover. As buscas e remoções usam CONSULTAS_BENCHMARK
+ * nomes espalhados pelos N itens.
+ *
+ * Todos os nomes são gerados antes de ligar o relógio, para que o
+ * snprintf não entre no tempo medido. Cada operação roda
+ * EXECUCOES_AQUECIMENTO vez(es) descartada(s) (primeiro malloc, caches)
+ * e depois se repete até somar TEMPO_MINIMO_MEDICAO, como no nível
+ * mestre; as operações que alteram a estrutura (ordenar, remover) a
+ * remontam fora do relógio antes de cada repetição. A saída é CSV ou
+ * JSON, uma linha/objeto por (estrutura, operação, N), com a mediana
+ * das repetições, para localizar os pontos de cruzamento no hardware
+ * real. Os itens do jogador são guardados antes e restaurados depois.
+ */
+
+#define CONSULTAS_BENCHMARK 32
+#define MAXIMO_BENCHMARK 10000000
+#define EXECUCOES_AQUECIMENTO 1          // Execuções descartadas antes de medir
+#define TEMPO_MINIMO_MEDICAO 10000000LL  // Nanossegundos somados por medição
+#define MAXIMO_EXECUCOES_MEDICAO 101
+
+typedef char NomeSintetico[30];
+
+/*
+ * SerieTempos: tempos das repetições de uma operação
+ * - tempos: nanossegundos de cada execução medida
+ * - execucoes: execuções medidas (sem o aquecimento)
+ * - totalNs: soma dos tempos medidos
+ */
+typedef struct
+{
+    long long tempos[MAXIMO_EXECUCOES_MEDICAO];
+    int execucoes;
+    long long totalNs;
+} SerieTempos;
+
+/*
+ * Função: relogioNs
+ * Descrição: lê um relógio monotônico
+ * Parâmetros: nenhum
+ * Retorno: instante atual em nanossegundos (origem arbitrária)
+ */
+long long relogioNs()
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequencia;
+    LARGE_INTEGER contador;
+
+    if (frequencia.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&frequencia);
+    }
+    QueryPerformanceCounter(&contador);
+
+    return (contador.QuadPart / frequencia.QuadPart) * 1000000000LL +
+           (contador.QuadPart % frequencia.QuadPart) * 1000000000LL / frequencia.QuadPart;
+#else
+    struct timespec agora;
+
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (long long)agora.tv_sec * 1000000000LL + agora.tv_nsec;
+#endif
+}
+
+/*
+ * Função: nomeSintetico
+ * Descrição: gera o nome do i-ésimo item sintético
+ * Parâmetros: destino (30 bytes) e número do item
+ * Retorno: nenhum
+ *
+ * Embaralha o número (splitmix64) para que a ordem de inserção não
+ * coincida com a ordem alfabética.
+ */
+void nomeSintetico(char *nome, long long numero)
+{
+    unsigned long long x = (unsigned long long)numero + 0x9E3779B97F4A7C15ULL;
+
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+
+    snprintf(nome, 30, "item%016llx", x);
+}
+
+/*
+ * Função: numeroConsulta
+ * Descrição: escolhe qual item sintético usar na k-ésima consulta
+ * Parâmetros: número da consulta, total de consultas e N
+ * Retorno: número do item (espalhado uniformemente entre 0 e N-1)
+ */
+long long numeroConsulta(int k, int consultas, long long n)
+{
+    return (long long)k * n / consultas;
+}
+
+/*
+ * Função: continuarSerie
+ * Descrição: decide se uma operação deve rodar mais uma vez
+ * Parâmetros: série e número da rodada (a partir de 0)
+ * Retorno: 1 para rodar de novo, 0 para parar
+ *
+ * As EXECUCOES_AQUECIMENTO primeiras rodadas sempre acontecem; depois,
+ * repete até somar TEMPO_MINIMO_MEDICAO (no mínimo uma medição).
+ */
+int continuarSerie(const SerieTempos *serie, int rodada)
+{
+    if (rodada < EXECUCOES_AQUECIMENTO)
+    {
+        return 1;
+    }
+    return serie->execucoes < MAXIMO_EXECUCOES_MEDICAO &&
+           (serie->execucoes == 0 || serie->totalNs < TEMPO_MINIMO_MEDICAO);
+}
+
+/*
+ * Função: anotarTempo
+ * Descrição: guarda o tempo de uma rodada (descarta o aquecimento)
+ * Parâmetros: série, número da rodada e tempo em nanossegundos
+ * Retorno: nenhum
+ */
+void anotarTempo(SerieTempos *serie, int rodada, long long ns)
+{
+    if (rodada < EXECUCOES_AQUECIMENTO)
+    {
+        return;
+    }
+    serie->tempos[serie->execucoes++] = ns;
+    serie->totalNs += ns;
+}
+
+/*
+ * Função: compararNs
+ * Descrição: ordem crescente de tempos (para qsort)
+ * Parâmetros: dois long long
+ * Retorno: <0, 0 ou >0
+ */
+int compararNs(const void *a, const void *b)
+{
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * Função: registrarMedicao
+ * Descrição: escreve uma medição em CSV ou JSON
+ * Parâmetros: saída, formato, se é a primeira medição, estrutura,
+ *             operação, N, operações por execução, série de tempos
+ *             (é ordenada) e comparações de uma execução
+ * Retorno: nenhum
+ */
+void registrarMedicao(FILE *saida, int formatoJson, int primeira, const char *estrutura,
+                      const char *operacao, long long n, long long operacoes,
+                      SerieTempos *serie, long long comparacoes)
+{
+    int execucoes = serie->execucoes;
+
+    qsort(serie->tempos, execucoes, sizeof(long long), compararNs);
+
+    double mediana = (execucoes % 2) ? (double)serie->tempos[execucoes / 2]
+                                     : (serie->tempos[execucoes / 2 - 1] + serie->tempos[execucoes / 2]) / 2.0;
+    double nsPorOperacao = (operacoes > 0) ? mediana / operacoes : 0.0;
+
+    if (formatoJson)
+    {
+        fprintf(saida, "%s\n    {\"estrutura\": \"%s\", \"operacao\": \"%s\", \"n\": %lld, "
+                       "\"operacoes\": %lld, \"execucoes\": %d, \"ns_mediana\": %.0f, "
+                       "\"ns_minimo\": %lld, \"ns_por_operacao\": %.1f, \"comparacoes\": %lld}",
+                primeira ? "" : ",", estrutura, operacao, n, operacoes, execucoes, mediana,
+                serie->tempos[0], nsPorOperacao, comparacoes);
+    }
+    else
+    {
+        fprintf(saida, "%s,%s,%lld,%lld,%d,%.0f,%lld,%.1f,%lld\n", estrutura, operacao, n, operacoes,
+                execucoes, mediana, serie->tempos[0], nsPorOperacao, comparacoes);
+    }
+}
+
+/*
+ * Função: montarVetor
+ * Descrição: esvazia o vetor e insere os nomes gerados (fora do relógio)
+ * Parâmetros: nomes, N e 1 para deixar o vetor ordenado
+ * Retorno: nenhum
+ */
+void montarVetor(NomeSintetico *nomes, long long n, int ordenar)
+{
+    liberarVetor();
+    for (long long i = 0; i < n; i++)
+    {
+        if (!inserirItemVetor(nomes[i], "sintetico", 1))
+        {
+            break;
+        }
+    }
+    if (ordenar)
+    {
+        ordenarItens(mochilaVetor, totalItensVetor);
+        vetorOrdenado = 1;
+    }
+}
+
+/*
+ * Função: medirVetor
+ * Descrição: executa e mede as operações do vetor com N itens
+ * Parâmetros: nomes dos N itens, nomes das consultas, N, saída, formato
+ *             e contador de medições já escritas
+ * Retorno: nenhum
+ *
+ * Espera o vetor vazio e o deixa vazio ao terminar.
+ */
+void medirVetor(NomeSintetico *nomes, NomeSintetico *consultasNomes, long long n, FILE *saida,
+                int formatoJson, int *medicoes)
+{
+    int consultas = (n < CONSULTAS_BENCHMARK) ? (int)n : CONSULTAS_BENCHMARK;
+    long long comparacoes = 0;
+    SerieTempos serie;
+
+    modoVetorOrdenado = 0;
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        liberarVetor();
+
+        long long inicio = relogioNs();
+        for (long long i = 0; i < n; i++)
+        {
+            if (!inserirItemVetor(nomes[i], "sintetico", 1))
+            {
+                break;
+            }
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "vetor", "inserir", n, n, &serie, 0);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        comparacoes = 0;
+
+        long long inicio = relogioNs();
+        for (int k = 0; k < consultas; k++)
+        {
+            buscarSequencialVetor(consultasNomes[k]);
+            comparacoes += comparacoesSequencialVetor;
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "vetor", "busca_sequencial", n,
+                     consultas, &serie, comparacoes);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        if (rodada > 0)
+        {
+            montarVetor(nomes, n, 0);
+        }
+        comparacoesOrdenacaoVetor = 0;
+
+        long long inicio = relogioNs();
+        ordenarItens(mochilaVetor, totalItensVetor);
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+        vetorOrdenado = 1;
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "vetor", "ordenar", n, 1, &serie,
+                     comparacoesOrdenacaoVetor);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        comparacoes = 0;
+
+        long long inicio = relogioNs();
+        for (int k = 0; k < consultas; k++)
+        {
+            buscarBinariaVetor(consultasNomes[k]);
+            comparacoes += comparacoesBinariaVetor;
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "vetor", "busca_binaria", n,
+                     consultas, &serie, comparacoes);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        if (rodada > 0)
+        {
+            montarVetor(nomes, n, 1);
+        }
+
+        long long inicio = relogioNs();
+        for (int k = 0; k < consultas; k++)
+        {
+            removerItemVetor(consultasNomes[k]);
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "vetor", "remover", n, consultas,
+                     &serie, 0);
+
+    liberarVetor();
+}
+
+/*
+ * Função: montarLista
+ * Descrição: esvazia a lista e insere os nomes gerados (fora do relógio)
+ * Parâmetros: nomes, N e 1 para deixar a lista ordenada
+ * Retorno: nenhum
+ */
+void montarLista(NomeSintetico *nomes, long long n, int ordenar)
+{
+    liberarLista();
+    for (long long i = 0; i < n; i++)
+    {
+        if (!inserirItemLista(nomes[i], "sintetico", 1))
+        {
+            break;
+        }
+    }
+    if (ordenar)
+    {
+        ordenarLista();
+    }
+}
+
+/*
+ * Função: medirLista
+ * Descrição: executa e mede as operações da lista com N itens
+ * Parâmetros: nomes dos N itens, nomes das consultas, N, saída, formato
+ *             e contador de medições já escritas
+ * Retorno: nenhum
+ *
+ * Espera a lista vazia e o deixa vazia ao terminar.
+ */
+void medirLista(NomeSintetico *nomes, NomeSintetico *consultasNomes, long long n, FILE *saida,
+                int formatoJson, int *medicoes)
+{
+    int consultas = (n < CONSULTAS_BENCHMARK) ? (int)n : CONSULTAS_BENCHMARK;
+    long long comparacoes = 0;
+    SerieTempos serie;
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        liberarLista();
+
+        long long inicio = relogioNs();
+        for (long long i = 0; i < n; i++)
+        {
+            if (!inserirItemLista(nomes[i], "sintetico", 1))
+            {
+                break;
+            }
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "lista", "inserir", n, n, &serie, 0);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        comparacoes = 0;
+
+        long long inicio = relogioNs();
+        for (int k = 0; k < consultas; k++)
+        {
+            buscarSequencialLista(consultasNomes[k]);
+            comparacoes += comparacoesSequencialLista;
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "lista", "busca_sequencial", n,
+                     consultas, &serie, comparacoes);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        if (rodada > 0)
+        {
+            montarLista(nomes, n, 0);
+        }
+
+        long long inicio = relogioNs();
+        ordenarLista();
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "lista", "ordenar", n, 1, &serie,
+                     comparacoesOrdenacaoLista);
+
+    serie.execucoes = 0;
+    serie.totalNs = 0;
+    for (int rodada = 0; continuarSerie(&serie, rodada); rodada++)
+    {
+        if (rodada > 0)
+        {
+            montarLista(nomes, n, 1);
+        }
+
+        long long inicio = relogioNs();
+        for (int k = 0; k < consultas; k++)
+        {
+            removerItemLista(consultasNomes[k]);
+        }
+        anotarTempo(&serie, rodada, relogioNs() - inicio);
+    }
+    registrarMedicao(saida, formatoJson, (*medicoes)++ == 0, "lista", "remover", n, consultas,
+                     &serie, 0);
+
+    liberarLista();
+}
+
+/*
+ * Função: executarBenchmark
+ * Descrição: roda o benchmark para N = 10, 100, ... até o máximo
+ * Parâmetros: N máximo, saída e formato (1 = JSON, 0 = CSV)
+ * Retorno: 1 se concluiu, 0 se faltou memória para os nomes de algum N
+ *          (as medições até o N anterior já foram escritas)
+ */
+int executarBenchmark(long long maximo, FILE *saida, int formatoJson)
+{
+    // Guarda o estado do jogador: o benchmark usa as mesmas estruturas
+    Item *vetorSalvo = mochilaVetor;
+    int capacidadeSalva = capacidadeVetor;
+    void *regiaoSalva = regiaoMapeada;
+    size_t tamanhoMapeadoSalvo = tamanhoMapeado;
+    int alteradoSalvo = vetorAlterado;
+    int totalVetorSalvo = totalItensVetor;
+    int ordenadoSalvo = vetorOrdenado;
+    int modoSalvo = modoVetorOrdenado;
+    int contadoresVetor[4] = {comparacoesSequencialVetor, comparacoesBinariaVetor,
+                              comparacoesOrdenacaoVetor, comparacoesInsercaoVetor};
+
+    No *listaSalva = mochilaLista;
+    No *caudaSalva = caudaLista;
+    int totalListaSalvo = totalItensLista;
+    PoolNos poolSalvo = poolLista;
+    int contadoresLista[2] = {comparacoesSequencialLista, comparacoesOrdenacaoLista};
+
+    // Os tipos do benchmark não devem ir parar no snapshot do jogador
+    guardarTipos();
+
+    mochilaVetor = NULL;
+    capacidadeVetor = 0;
+    totalItensVetor = 0;
+    vetorOrdenado = 1;
+    regiaoMapeada = NULL;
+
+    mochilaLista = NULL;
+    caudaLista = NULL;
+    totalItensLista = 0;
+    poolLista = (PoolNos){NULL, NOS_POR_BLOCO, NULL};
+
+    int medicoes = 0;
+    int concluiu = 1;
+    NomeSintetico consultasNomes[CONSULTAS_BENCHMARK];
+
+    if (formatoJson)
+    {
+        fprintf(saida, "{\n  \"benchmark\": \"vetor_x_lista\",\n  \"consultas\": %d,\n  \"medicoes\": [",
+                CONSULTAS_BENCHMARK);
+    }
+    else
+    {
+        fprintf(saida, "estrutura,operacao,n,operacoes,execucoes,ns_mediana,ns_minimo,ns_por_operacao,"
+                       "comparacoes\n");
+    }
+
+    for (long long n = 10; n <= maximo; n *= 10)
+    {
+        // Nomes gerados fora do relógio: o snprintf não entra nas medições
+        NomeSintetico *nomes = (NomeSintetico *)malloc((size_t)n * sizeof(NomeSintetico));
+        if (nomes == NULL)
+        {
+            concluiu = 0;
+            break;
+        }
+
+        int consultas = (n < CONSULTAS_BENCHMARK) ? (int)n : CONSULTAS_BENCHMARK;
+        for (long long i = 0; i < n; i++)
+        {
+            nomeSintetico(nomes[i], i);
+        }
+        for (int k = 0; k < consultas; k++)
+        {
+            memcpy(consultasNomes[k], nomes[numeroConsulta(k, consultas, n)], sizeof(NomeSintetico));
+        }
+
+        medirVetor(nomes, consultasNomes, n, saida, formatoJson, &medicoes);
+        medirLista(nomes, consultasNomes, n, saida, formatoJson, &medicoes);
+        free(nomes);
+        fflush(saida);
+    }
+
+    if (formatoJson)
+    {
+        fprintf(saida, "\n  ]\n}\n");
+    }
+    fflush(saida);
+
+    // Restaura o estado do jogador
+    mochilaVetor = vetorSalvo;
+    capacidadeVetor = capacidadeSalva;
+    regiaoMapeada = regiaoSalva;
+    tamanhoMapeado = tamanhoMapeadoSalvo;
+    vetorAlterado = alteradoSalvo;
+    totalItensVetor = totalVetorSalvo;
+    vetorOrdenado = ordenadoSalvo;
+    modoVetorOrdenado = modoSalvo;
+    comparacoesSequencialVetor = contadoresVetor[0];
+    comparacoesBinariaVetor = contadoresVetor[1];
+    comparacoesOrdenacaoVetor = contadoresVetor[2];
+    comparacoesInsercaoVetor = contadoresVetor[3];
+
+    restaurarTipos();
+
+    mochilaLista = listaSalva;
+    caudaLista = caudaSalva;
+    totalItensLista = totalListaSalvo;
+    poolLista = poolSalvo;
+    comparacoesSequencialLista = contadoresLista[0];
+    comparacoesOrdenacaoLista = contadoresLista[1];
+
+    return concluiu;
+}
+
+/*
+ * Função: telaBenchmark
+ * Descrição: pergunta os parâmetros e roda o benchmark pelo menu
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void telaBenchmark()
+{
+    printf("\n%s\n", LINHA);
+    printf("   ⏱️  BENCHMARK VETOR x LISTA (DADOS SINTÉTICOS) ⏱️\n");
+    printf("%s\n", LINHA);
+
+    long long maximo;
+    int formato;
+    char arquivo[256];
+
+    printf("N máximo (10 a %d, ex: 100000): ", MAXIMO_BENCHMARK);
+    scanf("%lld", &maximo);
+    getchar();
+
+    if (maximo < 10 || maximo > MAXIMO_BENCHMARK)
+    {
+        printf("❌ Erro: N deve estar entre 10 e %d!\n", MAXIMO_BENCHMARK);
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Formato (1 = CSV, 2 = JSON): ");
+    scanf("%d", &formato);
+    getchar();
+
+    printf("Arquivo de saída (Enter = tela): ");
+    fgets(arquivo, sizeof(arquivo), stdin);
+    arquivo[strcspn(arquivo, "\n")] = 0;
+
+    FILE *saida = stdout;
+    if (arquivo[0] != '\0')
+    {
+        saida = fopen(arquivo, "w");
+        if (saida == NULL)
+        {
+            printf("❌ Erro: não foi possível criar '%s'!\n", arquivo);
+            printf("%s\n\n", LINHA);
+            return;
+        }
+    }
+
+    printf("\n⏳ Medindo (N = 10 até %lld)...\n\n", maximo);
+    int concluiu = executarBenchmark(maximo, saida, formato == 2);
+
+    if (saida != stdout)
+    {
+        fclose(saida);
+        if (concluiu)
+        {
+            printf("✅ Resultados gravados em '%s'\n", arquivo);
+        }
+    }
+
+    if (!concluiu)
+    {
+        printf("❌ Erro: memória insuficiente para N = %lld!\n", maximo);
+    }
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * FUNÇÕES - LISTA DESENROLADA
+ * ========================================
+ *
+ * Cada nó guarda um bloco contíguo de até ITENS_POR_NO itens. A
+ * inserção no final continua O(1) (ponteiro de cauda), mas a busca
+ * percorre memória contígua e faz um salto de ponteiro a cada
+ * ITENS_POR_NO itens, e não a cada item.
+ *
+ * Para não desperdiçar espaço, um nó que cai abaixo da metade após
+ * uma remoção pega itens do vizinho ou se funde com ele.
+ */
+
+#define MINIMO_POR_NO (ITENS_POR_NO / 2)
+
+/*
+ * Função: inserirItemDesenrolada
+ * Descrição: insere um item no final da lista desenrolada
+ * Parâmetros: nome, tipo, quantidade do item
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * Complexidade: O(1) - usa o ponteiro de cauda
+ */
+int inserirItemDesenrolada(const char *nome, const char *tipo, int quantidade)
+{
+    int numeroTipo = internarTipo(tipo);
+
+    if (numeroTipo == -1)
+    {
+        return 0;
+    }
+
+    if (caudaDesenrolada == NULL || caudaDesenrolada->quantidade == ITENS_POR_NO)
+    {
+        NoDesenrolado *novoNo = (NoDesenrolado *)malloc(sizeof(NoDesenrolado));
+
+        if (novoNo == NULL)
+        {
+            printf("❌ Erro ao alocar memória!\n");
+            return 0;
+        }
+
+        novoNo->quantidade = 0;
+        novoNo->proximo = NULL;
+
+        if (caudaDesenrolada == NULL)
+        {
+            mochilaDesenrolada = novoNo;
+        }
+        else
+        {
+            caudaDesenrolada->proximo = novoNo;
+        }
+        caudaDesenrolada = novoNo;
+    }
+
+    Item *item = &caudaDesenrolada->itens[caudaDesenrolada->quantidade++];
+    strcpy(item->nome, nome);
+    item->tipo = (unsigned char)numeroTipo;
+    item->quantidade = quantidade;
+
+    totalItensDesenrolada++;
+    return 1;
+}
+
+/*
+ * Função: rebalancearNoDesenrolado
+ * Descrição: corrige um nó que ficou com menos da metade dos itens
+ * Parâmetros: nó anterior (ou NULL se for a cabeça) e o nó
+ * Retorno: nenhum
+ *
+ * Nó vazio é descartado; nó esparso se funde com o próximo se os dois
+ * couberem juntos, ou pega itens dele até atingir a metade.
+ */
+void rebalancearNoDesenrolado(NoDesenrolado *anterior, NoDesenrolado *no)
+{
+    if (no->quantidade == 0)
+    {
+        if (anterior == NULL)
+        {
+            mochilaDesenrolada = no->proximo;
+        }
+        else
+        {
+            anterior->proximo = no->proximo;
+        }
+
+        if (caudaDesenrolada == no)
+        {
+            caudaDesenrolada = anterior;
+        }
+        free(no);
+        return;
+    }
+
+    NoDesenrolado *proximo = no->proximo;
+    if (no->quantidade >= MINIMO_POR_NO || proximo == NULL)
+    {
+        return;
+    }
+
+    if (no->quantidade + proximo->quantidade <= ITENS_POR_NO)
+    {
+        // Fusão: o próximo nó inteiro vem para este
+        memcpy(&no->itens[no->quantidade], proximo->itens, proximo->quantidade * sizeof(Item));
+        no->quantidade += proximo->quantidade;
+        no->proximo = proximo->proximo;
+
+        if (caudaDesenrolada == proximo)
+        {
+            caudaDesenrolada = no;
+        }
+        free(proximo);
+    }
+    else
+    {
+        // Empréstimo: traz itens do início do próximo até atingir a metade
+        int faltam = MINIMO_POR_NO - no->quantidade;
+
+        memcpy(&no->itens[no->quantidade], proximo->itens, faltam * sizeof(Item));
+        memmove(proximo->itens, &proximo->itens[faltam], (proximo->quantidade - faltam) * sizeof(Item));
+        no->quantidade += faltam;
+        proximo->quantidade -= faltam;
+    }
+}
+
+/*
+ * Função: removerItemDesenrolada
+ * Descrição: remove um item da lista desenrolada pelo nome
+ * Parâmetros: nome do item a remover
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * A busca é O(n); a remoção em si desloca no máximo ITENS_POR_NO itens.
+ */
+int removerItemDesenrolada(const char *nome)
+{
+    NoDesenrolado *anterior = NULL;
+    NoDesenrolado *no = mochilaDesenrolada;
+
+    while (no != NULL)
+    {
+        for (int i = 0; i < no->quantidade; i++)
+        {
+            if (strcmp(no->itens[i].nome, nome) == 0)
+            {
+                // Fecha o buraco dentro do nó
+                memmove(&no->itens[i], &no->itens[i + 1], (no->quantidade - i - 1) * sizeof(Item));
+                no->quantidade--;
+                totalItensDesenrolada--;
+
+                rebalancearNoDesenrolado(anterior, no);
+                return 1;
+            }
+        }
+
+        anterior = no;
+        no = no->proximo;
+    }
+
+    return 0;
+}
+
+/*
+ * Função: listarPaginaDesenrolada
+ * Descrição: exibe uma página da tabela da lista desenrolada
+ * Parâmetros: ordem do primeiro item e máximo de itens
+ * Retorno: nenhum
+ *
+ * Pula nós inteiros até a página: O(inicio / ITENS_POR_NO) saltos.
+ */
+void listarPaginaDesenrolada(int inicio, int limite)
+{
+    NoDesenrolado *no = mochilaDesenrolada;
+    int posicao = inicio;
+
+    while (no != NULL && posicao >= no->quantidade)
+    {
+        posicao -= no->quantidade;
+        no = no->proximo;
+    }
+
+    anexarCabecalhoTabela(inicio, limite, totalItensDesenrolada);
+
+    int contador = inicio + 1;
+    while (no != NULL && limite > 0)
+    {
+        for (; posicao < no->quantidade && limite > 0; posicao++, limite--)
+        {
+            anexarLinhaTabela(contador++, &no->itens[posicao]);
+        }
+        posicao = 0;
+        no = no->proximo;
+    }
+
+    fecharTabela();
+}
+
+/*
+ * Função: exibirItensDesenrolada
+ * Descrição: exibe os itens da lista desenrolada em formato tabular
+ * Parâmetros: 1 para paginar interativamente, 0 para só a primeira página
+ * Retorno: nenhum
+ */
+void exibirItensDesenrolada(int interativo)
+{
+    printf("\n%s\n", LINHA);
+    printf("   📦 ITENS DO INVENTÁRIO (LISTA DESENROLADA) 📦\n");
+    printf("%s\n", LINHA);
+
+    if (mochilaDesenrolada == NULL)
+    {
+        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Total de itens: ");
+    exibirContagem(totalItensDesenrolada);
+    printf("\n");
+    paginarTabela(totalItensDesenrolada, listarPaginaDesenrolada, interativo);
+}
+
+/*
+ * Função: listarItensDesenrolada
+ * Descrição: exibe todos os itens da lista desenrolada, página a página
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void listarItensDesenrolada()
+{
+    exibirItensDesenrolada(1);
+}
+
+/*
+ * Função: buscarSequencialDesenrolada
+ * Descrição: busca item na lista desenrolada e conta comparações
+ * Parâmetros: nome do item
+ * Retorno: ponteiro para o item encontrado ou NULL
+ */
+Item *buscarSequencialDesenrolada(const char *nome)
+{
+    comparacoesSequencialDesenrolada = 0;
+
+    for (NoDesenrolado *no = mochilaDesenrolada; no != NULL; no = no->proximo)
+    {
+        for (int i = 0; i < no->quantidade; i++)
+        {
+            comparacoesSequencialDesenrolada++;
+            if (strcmp(no->itens[i].nome, nome) == 0)
+            {
+                return &no->itens[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Função: liberarDesenrolada
+ * Descrição: libera toda a memória da lista desenrolada
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Importante: deve ser chamada ao sair do programa
+ */
+void liberarDesenrolada()
+{
+    NoDesenrolado *no = mochilaDesenrolada;
+
+    while (no != NULL)
+    {
+        NoDesenrolado *temp = no;
+        no = no->proximo;
+        free(temp);
+    }
+
+    mochilaDesenrolada = NULL;
+    caudaDesenrolada = NULL;
+    totalItensDesenrolada = 0;
+}
+
+/* ========================================
+ * FUNÇÕES - SKIP LIST
+ * ========================================
+ *
+ * Lista encadeada ordenada por nome com "atalhos": cada nó sobe para
+ * o nível seguinte com probabilidade 1/2. A busca começa no nível
+ * mais alto e desce quando o próximo nome passaria do procurado,
+ * descartando metade dos itens restantes a cada nível (O(log n)
+ * esperado). Inserção e remoção reutilizam o mesmo caminho.
+ */
+
+/*
+ * Função: criarNoSkip
+ * Descrição: aloca um nó da skip list com o número de níveis pedido
+ * Parâmetros: número de níveis
+ * Retorno: ponteiro para o nó ou NULL se falhou
+ */
+NoSkip *criarNoSkip(int nivel)
+{
+    NoSkip *no = (NoSkip *)malloc(sizeof(NoSkip) + nivel * sizeof(NoSkip *));
+
+    if (no == NULL)
+    {
+        return NULL;
+    }
+
+    no->nivel = nivel;
+    for (int i = 0; i < nivel; i++)
+    {
+        no->proximo[i] = NULL;
+    }
+
+    return no;
+}
+
+/*
+ * Função: sortearNivelSkip
+ * Descrição: sorteia o nível de um novo nó (distribuição geométrica)
+ * Parâmetros: nenhum
+ * Retorno: nível entre 1 e NIVEL_MAXIMO_SKIP
+ */
+int sortearNivelSkip()
+{
+    int nivel = 1;
+
+    while (nivel < NIVEL_MAXIMO_SKIP && (rand() & 1))
+    {
+        nivel++;
+    }
+
+    return nivel;
+}
+
+/*
+ * Função: localizarSkip
+ * Descrição: desce pelos níveis até o ponto onde o nome estaria
+ * Parâmetros: nome procurado e vetor que recebe, por nível, o último
+ *             nó com nome menor que o procurado
+ * Retorno: primeiro nó com nome >= ao procurado (ou NULL)
+ *
+ * Soma em comparacoesSkip cada strcmp realizado.
+ */
+NoSkip *localizarSkip(const char *nome, NoSkip *anteriores[])
+{
+    NoSkip *atual = cabecaSkip;
+
+    for (int i = nivelSkip - 1; i >= 0; i--)
+    {
+        while (atual->proximo[i] != NULL)
+        {
+            comparacoesSkip++;
+            if (strcmp(atual->proximo[i]->dados.nome, nome) >= 0)
+            {
+                break;
+            }
+            atual = atual->proximo[i];
+        }
+        anteriores[i] = atual;
+    }
+
+    return atual->proximo[0];
+}
+
+/*
+ * Função: inserirItemSkip
+ * Descrição: insere um item na skip list mantendo a ordem por nome
+ * Parâmetros: nome, tipo, quantidade do item
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * Complexidade: O(log n) esperado
+ */
+int inserirItemSkip(const char *nome, const char *tipo, int quantidade)
+{
+    int numeroTipo = internarTipo(tipo);
+
+    if (numeroTipo == -1)
+    {
+        return 0;
+    }
+
+    if (cabecaSkip == NULL)
+    {
+        cabecaSkip = criarNoSkip(NIVEL_MAXIMO_SKIP);
+        if (cabecaSkip == NULL)
+        {
+            printf("❌ Erro ao alocar memória!\n");
+            return 0;
+        }
+    }
+
+    NoSkip *anteriores[NIVEL_MAXIMO_SKIP];
+    comparacoesSkip = 0;
+    localizarSkip(nome, anteriores);
+
+    int nivel = sortearNivelSkip();
+    NoSkip *novoNo = criarNoSkip(nivel);
+
+    if (novoNo == NULL)
+    {
+        printf("❌ Erro ao alocar memória!\n");
+        return 0;
+    }
+
+    strcpy(novoNo->dados.nome, nome);
+    novoNo->dados.tipo = (unsigned char)numeroTipo;
+    novoNo->dados.quantidade = quantidade;
+
+    // Níveis novos partem direto da sentinela
+    for (int i = nivelSkip; i < nivel; i++)
+    {
+        anteriores[i] = cabecaSkip;
+    }
+    if (nivel > nivelSkip)
+    {
+        nivelSkip = nivel;
+    }
+
+    for (int i = 0; i < nivel; i++)
+    {
+        novoNo->proximo[i] = anteriores[i]->proximo[i];
+        anteriores[i]->proximo[i] = novoNo;
+    }
+
+    totalItensSkip++;
+    return 1;
+}
+
+/*
+ * Função: removerItemSkip
+ * Descrição: remove um item da skip list pelo nome
+ * Parâmetros: nome do item a remover
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * Complexidade: O(log n) esperado
+ */
+int removerItemSkip(const char *nome)
+{
+    if (cabecaSkip == NULL)
+    {
+        return 0;
+    }
+
+    NoSkip *anteriores[NIVEL_MAXIMO_SKIP];
+    comparacoesSkip = 0;
+    NoSkip *alvo = localizarSkip(nome, anteriores);
+
+    if (alvo == NULL || strcmp(alvo->dados.nome, nome) != 0)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < alvo->nivel; i++)
+    {
+        anteriores[i]->proximo[i] = alvo->proximo[i];
+    }
+    free(alvo);
+
+    // Descarta níveis que ficaram vazios
+    while (nivelSkip > 1 && cabecaSkip->proximo[nivelSkip - 1] == NULL)
+    {
+        nivelSkip--;
+    }
+
+    totalItensSkip--;
+    return 1;
+}
+
+/*
+ * Função: buscarItemSkip
+ * Descrição: busca item na skip list e conta comparações
+ * Parâmetros: nome do item
+ * Retorno: ponteiro para o item encontrado ou NULL
+ */
+Item *buscarItemSkip(const char *nome)
+{
+    Item *resultado = NULL;
+
+    comparacoesSkip = 0;
+
+    if (cabecaSkip != NULL)
+    {
+        NoSkip *anteriores[NIVEL_MAXIMO_SKIP];
+        NoSkip *no = localizarSkip(nome, anteriores);
+
+        if (no != NULL)
+        {
+            comparacoesSkip++;
+            if (strcmp(no->dados.nome, nome) == 0)
+            {
+                resultado = &no->dados;
+            }
+        }
+    }
+
+    comparacoesBuscaSkip = comparacoesSkip;
+    return resultado;
+}
+
+/*
+ * Função: listarPaginaSkip
+ * Descrição: exibe uma página da tabela da skip list (em ordem)
+ * Parâmetros: ordem do primeiro item e máximo de itens
+ * Retorno: nenhum
+ */
+void listarPaginaSkip(int inicio, int limite)
+{
+    NoSkip *atual = cabecaSkip->proximo[0];
+
+    for (int i = 0; i < inicio && atual != NULL; i++)
+    {
+        atual = atual->proximo[0];
+    }
+
+    anexarCabecalhoTabela(inicio, limite, totalItensSkip);
+
+    int contador = inicio + 1;
+    while (atual != NULL && limite-- > 0)
+    {
+        anexarLinhaTabela(contador++, &atual->dados);
+        atual = atual->proximo[0];
+    }
+
+    fecharTabela();
+}
+
+/*
+ * Função: exibirItensSkip
+ * Descrição: exibe os itens da skip list em formato tabular
+ * Parâmetros: 1 para paginar interativamente, 0 para só a primeira página
+ * Retorno: nenhum
+ */
+void exibirItensSkip(int interativo)
+{
+    printf("\n%s\n", LINHA);
+    printf("   📦 ITENS DO INVENTÁRIO (SKIP LIST) 📦\n");
+    printf("%s\n", LINHA);
+
+    if (totalItensSkip == 0)
+    {
+        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Total de itens: ");
+    exibirContagem(totalItensSkip);
+    printf(" (níveis em uso: %d)\n", nivelSkip);
+    paginarTabela(totalItensSkip, listarPaginaSkip, interativo);
+}
+
+/*
+ * Função: listarItensSkip
+ * Descrição: exibe todos os itens da skip list, página a página
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void listarItensSkip()
+{
+    exibirItensSkip(1);
+}
+
+/*
+ * Função: liberarSkip
+ * Descrição: libera toda a memória da skip list
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Importante: deve ser chamada ao sair do programa
+ */
+void liberarSkip()
+{
+    NoSkip *atual = cabecaSkip;
+
+    while (atual != NULL)
+    {
+        NoSkip *temp = atual;
+        atual = atual->proximo[0];
+        free(temp);
+    }
+
+    cabecaSkip = NULL;
+    nivelSkip = 1;
+    totalItensSkip = 0;
+}
+
+/* ========================================
+ * FUNÇÕES - MENUS INTERATIVOS
+ * ======================================== */
+
+/*
+ * Função: menuVetor
+ * Descrição: menu de operações sobre a mochila com VETOR
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void menuVetor()
+{
+    int opcao;
+
+    while (1)
+    {
+        printf("\n%s\n", LINHA);
+        printf("     🎮 SISTEMA COM VETOR (Lista Sequencial) 🎮\n");
+        printf("%s\n", LINHA);
+        printf("Escolha uma opção:\n\n");
+        printf("  1️⃣  - Adicionar item à mochila\n");
+        printf("  2️⃣  - Remover item da mochila\n");
+        printf("  3️⃣  - Listar todos os itens\n");
+        printf("  4️⃣  - Buscar item (Sequencial com contador)\n");
+        printf("  5️⃣  - Ordenar itens alfabeticamente\n");
+        printf("  6️⃣  - Buscar binária (requer ordenação)\n");
+        printf("  7️⃣  - Comparar desempenho de buscas\n");
+        printf("  8️⃣  - %s modo sempre ordenado (inserção binária)\n",
+               modoVetorOrdenado ? "Desativar" : "Ativar");
+        printf("  9️⃣  - Voltar ao menu principal\n");
+        printf("%s\n", LINHA);
+        printf("Digite sua opção (1-9): ");
+        scanf("%d", &opcao);
+        getchar();
+
+        switch (opcao)
+        {
+        case 1:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         ➕ CADASTRAR NOVO ITEM ➕\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensVetor > MAX_ITENS)
+            {
+                printf("❌ Erro: o snapshot carregado tem %d itens, acima do limite de %d do jogo.\n",
+                       totalItensVetor, MAX_ITENS);
+                printf("   Remova itens até ficar abaixo do limite para adicionar novos.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+            if (totalItensVetor == MAX_ITENS)
+            {
+                printf("❌ Erro: Sua mochila está cheia! Máximo de %d itens.\n", MAX_ITENS);
+                printf("   Remova alguns itens antes de adicionar novos.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30], tipo[20];
+            int quantidade;
+
+            printf("Digite o nome do item: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            printf("Digite o tipo (ex: arma, munição, cura, ferramenta): ");
+            fgets(tipo, sizeof(tipo), stdin);
+            tipo[strcspn(tipo, "\n")] = 0;
+
+            printf("Digite a quantidade: ");
+            scanf("%d", &quantidade);
+            getchar();
+
+            if (quantidade <= 0)
+            {
+                printf("❌ Erro: A quantidade deve ser maior que zero!\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (procurarTipo(tipo) == -1 && totalTipos == MAX_TIPOS)
+            {
+                printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (inserirItemVetor(nome, tipo, quantidade))
+            {
+                printf("✅ Item '%s' adicionado com sucesso à mochila!\n", nome);
+                if (modoVetorOrdenado)
+                {
+                    printf("   Posição encontrada com %d comparações (busca binária)\n",
+                           comparacoesInsercaoVetor);
+                }
+                printf("%s\n", LINHA);
+                exibirItensVetor(0);
+            }
+            else
+            {
+                printf("❌ Erro ao adicionar item!\n");
+            }
+            break;
+        }
+
+        case 2:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         ❌ REMOVER ITEM ❌\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensVetor == 0)
+            {
+                printf("⚠️  Sua mochila está vazia! Nada para remover.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30];
+            printf("Digite o nome do item a remover: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            if (removerItemVetor(nome))
+            {
+                printf("✅ Item '%s' encontrado e removido!\n", nome);
+                printf("%s\n", LINHA);
+                exibirItensVetor(0);
+            }
+            else
+            {
+                printf("❌ Item '%s' não encontrado na mochila!\n", nome);
+                printf("%s\n\n", LINHA);
+            }
+            break;
+        }
+
+        case 3:
+            listarItensVetor();
+            break;
+
+        case 4:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         🔍 BUSCAR ITEM 🔍\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensVetor == 0)
+            {
+                printf("⚠️  Sua mochila está vazia! Nada para buscar.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30];
+            printf("Digite o nome do item a buscar: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            int resultado = buscarSequencialVetor(nome);
+
+            if (resultado != -1)
+            {
+                printf("✅ Item encontrado!\n\n");
+                printf("📌 Nome: %s\n", mochilaVetor[resultado].nome);
+                printf("🏷️  Tipo: %s\n", nomeDoTipo(mochilaVetor[resultado].tipo));
+                printf("📊 Quantidade: %d\n", mochilaVetor[resultado].quantidade);
+            }
+            else
+            {
+                printf("❌ Item '%s' não encontrado na mochila!\n", nome);
+            }
+
+            printf("\n📊 Estatísticas da busca:\n");
+            printf("   Comparações realizadas: %d\n", comparacoesSequencialVetor);
+            printf("   Complexidade: O(n)\n");
+            printf("%s\n\n", LINHA);
+            break;
+        }
+
+        case 5:
+        {
+            if (totalItensVetor == 0)
+            {
+                printf("\n⚠️  Sua mochila está vazia! Nada para ordenar.\n");
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("        ⬆️✔️ ORDENANDO ITENS ✔️⬆️\n");
+            printf("%s\n", LINHA);
+            ordenarVetor();
+
+            printf("✅ Itens ordenados com sucesso!\n");
+            printf("   Comparações realizadas: %d\n", comparacoesOrdenacaoVetor);
+            printf("   Complexidade: O(n log n)\n");
+            printf("%s\n", LINHA);
+            exibirItensVetor(0);
+            break;
+        }
+
+        case 6:
+        {
+            printf("\n%s\n", LINHA);
+            printf("      🔦 BUSCA BINÁRIA (RÁPIDA) 🔦\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensVetor == 0)
+            {
+                printf("⚠️  Sua mochila está vazia!\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (!vetorOrdenado)
+            {
+                printf("⚠️  IMPORTANTE: Os itens não estão ORDENADOS!\n");
+                printf("   Use a opção 5 para ordenar ou a 8 para o modo sempre ordenado.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30];
+            printf("Digite o nome do item a buscar: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            int resultado = buscarBinariaVetor(nome);
+
+            if (resultado != -1)
+            {
+                printf("\n✅ ITEM ENCONTRADO!\n\n");
+                printf("📌 Nome: %s\n", mochilaVetor[resultado].nome);
+                printf("🏷️  Tipo: %s\n", nomeDoTipo(mochilaVetor[resultado].tipo));
+                printf("📊 Quantidade: %d\n", mochilaVetor[resultado].quantidade);
+            }
+            else
+            {
+                printf("\n❌ Item '%s' não encontrado!\n", nome);
+            }
+
+            printf("\n📊 Estatísticas da busca:\n");
+            printf("   Comparações realizadas: %d\n", comparacoesBinariaVetor);
+            printf("   Complexidade: O(log n)\n");
+            printf("%s\n\n", LINHA);
+            break;
+        }
+
+        case 7:
+        {
+            printf("\n%s\n", LINHA);
+            printf("    📈 COMPARAÇÃO DE DESEMPENHO - VETOR 📈\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensVetor == 0)
+            {
+                printf("⚠️  Adicione itens para comparar!\n");
+                break;
+            }
+
+            printf("\n1️⃣  BUSCA SEQUENCIAL:\n");
+            printf("   Comparações na última busca: %d\n", comparacoesSequencialVetor);
+            printf("   Complexidade: O(n)\n");
+            printf("   Melhor caso: 1 comparação\n");
+            printf("   Pior caso: %d comparações\n", totalItensVetor);
+
+            printf("\n2️⃣  BUSCA BINÁRIA (com vetor ordenado):\n");
+            printf("   Comparações na última busca: %d\n", comparacoesBinariaVetor);
+            printf("   Complexidade: O(log n)\n");
+
+            int comparacoesTeoricas = 1;
+            int temp = totalItensVetor;
+            while (temp > 1)
+            {
+                temp /= 2;
+                comparacoesTeoricas++;
+            }
+            printf("   Máx comparações teóricas: ~%d\n", comparacoesTeoricas);
+
+            printf("\n💡 CONCLUSÃO:\n");
+            if (totalItensVetor > 5)
+            {
+                printf("   A busca binária é MAIS EFICIENTE para este tamanho!\n");
+                printf("   Ganho: redução de até %d comparações.\n",
+                       comparacoesSequencialVetor - comparacoesBinariaVetor);
+            }
+            else
+            {
+                printf("   Para poucos itens, ambas são rápidas.\n");
+                printf("   Busca binária fica melhor com mais dados.\n");
+            }
+
+            printf("%s\n", LINHA);
+            break;
+        }
+
+        case 8:
+        {
+            printf("\n%s\n", LINHA);
+            ativarModoOrdenado(!modoVetorOrdenado);
+
+            if (modoVetorOrdenado)
+            {
+                printf("✅ Modo sempre ordenado ATIVADO!\n");
+                printf("   Cada inserção usa busca binária + deslocamento em bloco.\n");
+                printf("   A busca binária fica sempre disponível.\n");
+            }
+            else
+            {
+                printf("✅ Modo sempre ordenado DESATIVADO!\n");
+                printf("   Novos itens voltam a ser inseridos no final.\n");
+            }
+            printf("%s\n", LINHA);
+            break;
+        }
+
+        case 9:
+            return;
+
+        default:
+            printf("\n❌ Opção inválida! Digite um número entre 1 e 9.\n");
+        }
+    }
+}
+
+/*
+ * Função: menuLista
+ * Descrição: menu de operações sobre a mochila com LISTA ENCADEADA
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void menuLista()
+{
+    int opcao;
+
+    while (1)
+    {
+        printf("\n%s\n", LINHA);
+        printf("   🎮 SISTEMA COM LISTA ENCADEADA 🎮\n");
+        printf("%s\n", LINHA);
+        printf("Escolha uma opção:\n\n");
+        printf("  1️⃣  - Adicionar item à mochila\n");
+        printf("  2️⃣  - Remover item da mochila\n");
+        printf("  3️⃣  - Listar todos os itens\n");
+        printf("  4️⃣  - Buscar item (Sequencial com contador)\n");
+        printf("  5️⃣  - Ordenar itens por nome (Merge Sort)\n");
+        printf("  6️⃣  - Medir inserção em massa (cauda + pool)\n");
+        printf("  7️⃣  - Voltar ao menu principal\n");
+        printf("%s\n", LINHA);
+        printf("Digite sua opção (1-7): ");
+        scanf("%d", &opcao);
+        getchar();
+
+        switch (opcao)
+        {
+        case 1:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         ➕ CADASTRAR NOVO ITEM ➕\n");
+            printf("%s\n", LINHA);
+
+            if (totalItensLista >= MAX_ITENS)
+            {
+                printf("❌ Erro: Sua mochila está cheia! Máximo de %d itens.\n", MAX_ITENS);
+                printf("   Remova alguns itens antes de adicionar novos.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30], tipo[20];
+            int quantidade;
+
+            printf("Digite o nome do item: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            printf("Digite o tipo (ex: arma, munição, cura, ferramenta): ");
+            fgets(tipo, sizeof(tipo), stdin);
+            tipo[strcspn(tipo, "\n")] = 0;
+
+            printf("Digite a quantidade: ");
+            scanf("%d", &quantidade);
+            getchar();
+
+            if (quantidade <= 0)
+            {
+                printf("❌ Erro: A quantidade deve ser maior que zero!\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (procurarTipo(tipo) == -1 && totalTipos == MAX_TIPOS)
+            {
+                printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (inserirItemLista(nome, tipo, quantidade))
+            {
+                printf("✅ Item '%s' adicionado com sucesso à mochila!\n", nome);
+                printf("%s\n", LINHA);
+                exibirItensLista(0);
+            }
+            else
+            {
+                printf("❌ Erro ao adicionar item!\n");
+            }
+            break;
+        }
+
+        case 2:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         ❌ REMOVER ITEM ❌\n");
+            printf("%s\n", LINHA);
+
+            if (mochilaLista == NULL)
+            {
+                printf("⚠️  Sua mochila está vazia! Nada para remover.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30];
+            printf("Digite o nome do item a remover: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            if (removerItemLista(nome))
+            {
+                printf("✅ Item '%s' encontrado e removido!\n", nome);
+                printf("%s\n", LINHA);
+                exibirItensLista(0);
+            }
+            else
+            {
+                printf("❌ Item '%s' não encontrado na mochila!\n", nome);
+                printf("%s\n\n", LINHA);
+            }
+            break;
+        }
+
+        case 3:
+            listarItensLista();
+            break;
+
+        case 4:
+        {
+            printf("\n%s\n", LINHA);
+            printf("         🔍 BUSCAR ITEM 🔍\n");
+            printf("%s\n", LINHA);
+
+            if (mochilaLista == NULL)
+            {
+                printf("⚠️  Sua mochila está vazia! Nada para buscar.\n");
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            char nome[30];
+            printf("Digite o nome do item a buscar: ");
+            fgets(nome, sizeof(nome), stdin);
+            nome[strcspn(nome, "\n")] = 0;
+
+            No *resultado = buscarSequencialLista(nome);
+
+            if (resultado != NULL)
+            {
+                printf("✅ Item encontrado!\n\n");
+                printf("📌 Nome: %s\n", resultado->dados.nome);
+                printf("🏷️  Tipo: %s\n", nomeDoTipo(resultado->dados.tipo));
+                printf("📊 Quantidade: %d\n", resultado->dados.quantidade);
+            }
+            else
+            {
+                printf("❌ Item '%s' não encontrado na mochila!\n", nome);
+            }
+
+            printf("\n📊 Estatísticas da busca:\n");
+            printf("   Comparações realizadas: %d\n", comparacoesSequencialLista);
+            printf("   Complexidade: O(n)\n");
+            printf("%s\n\n", LINHA);
+            break;
+        }
+
+        case 5:
+        {
+            if (mochilaLista == NULL)
+            {
+                printf("\n⚠️  Sua mochila está vazia! Nada para ordenar.\n");
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("        ⬆️✔️ ORDENANDO ITENS ✔️⬆️\n");
+            printf("%s\n", LINHA);
+            printf("\n⏳ Ordenando itens alfabeticamente (Merge Sort)...\n");
+
+            ordenarLista();
+
+            printf("✅ Itens ordenados com sucesso!\n");
+            printf("   Comparações realizadas: %d\n", comparacoesOrdenacaoLista);
+            printf("   Complexidade: O(n log n), sem copiar itens\n");
+            printf("%s\n", LINHA);
+            exibirItensLista(0);
+            break;
+        }
+
+        case 6:
+            medirInsercaoEmMassa();
+            break;
+
+        case 7:
+            return;
 
-    while (atual != NULL)
-    {
-        No *temp = atual;
-        atual = atual->proximo;
-        free(temp);
+        default:
+            printf("❌ Opção inválida! Digite um número entre 1 e 7.\n");
+        }
     }
-
-    mochilaLista = NULL;
-    totalItensLista = 0;
 }
 
-/* ========================================
- * FUNÇÕES - MENUS INTERATIVOS
- * ======================================== */
-
 /*
- * Função: menuVetor
- * Descrição: menu de operações sobre a mochila com VETOR
+ * Função: menuListaDesenrolada
+ * Descrição: menu de operações sobre a mochila com LISTA DESENROLADA
  * Parâmetros: nenhum
  * Retorno: nenhum
  */
-void menuVetor()
+void menuListaDesenrolada()
 {
     int opcao;
 
     while (1)
     {
         printf("\n%s\n", LINHA);
-        printf("     🎮 SISTEMA COM VETOR (Lista Sequencial) 🎮\n");
+        printf("   🎮 SISTEMA COM LISTA DESENROLADA 🎮\n");
         printf("%s\n", LINHA);
         printf("Escolha uma opção:\n\n");
         printf("  1️⃣  - Adicionar item à mochila\n");
         printf("  2️⃣  - Remover item da mochila\n");
         printf("  3️⃣  - Listar todos os itens\n");
         printf("  4️⃣  - Buscar item (Sequencial com contador)\n");
-        printf("  5️⃣  - Ordenar itens alfabeticamente\n");
-        printf("  6️⃣  - Buscar binária (requer ordenação)\n");
-        printf("  7️⃣  - Comparar desempenho de buscas\n");
-        printf("  8️⃣  - Voltar ao menu principal\n");
+        printf("  5️⃣  - Voltar ao menu principal\n");
         printf("%s\n", LINHA);
-        printf("Digite sua opção (1-8): ");
+        printf("Digite sua opção (1-5): ");
         scanf("%d", &opcao);
         getchar();
 
@@ -511,7 +3777,7 @@ void menuVetor()
             printf("         ➕ CADASTRAR NOVO ITEM ➕\n");
             printf("%s\n", LINHA);
 
-            if (totalItensVetor >= MAX_ITENS)
+            if (totalItensDesenrolada >= MAX_ITENS)
             {
                 printf("❌ Erro: Sua mochila está cheia! Máximo de %d itens.\n", MAX_ITENS);
                 printf("   Remova alguns itens antes de adicionar novos.\n");
@@ -541,11 +3807,18 @@ void menuVetor()
                 break;
             }
 
-            if (inserirItemVetor(nome, tipo, quantidade))
+            if (procurarTipo(tipo) == -1 && totalTipos == MAX_TIPOS)
+            {
+                printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (inserirItemDesenrolada(nome, tipo, quantidade))
             {
                 printf("✅ Item '%s' adicionado com sucesso à mochila!\n", nome);
                 printf("%s\n", LINHA);
-                listarItensVetor();
+                exibirItensDesenrolada(0);
             }
             else
             {
@@ -560,7 +3833,7 @@ void menuVetor()
             printf("         ❌ REMOVER ITEM ❌\n");
             printf("%s\n", LINHA);
 
-            if (totalItensVetor == 0)
+            if (mochilaDesenrolada == NULL)
             {
                 printf("⚠️  Sua mochila está vazia! Nada para remover.\n");
                 printf("%s\n\n", LINHA);
@@ -572,11 +3845,11 @@ void menuVetor()
             fgets(nome, sizeof(nome), stdin);
             nome[strcspn(nome, "\n")] = 0;
 
-            if (removerItemVetor(nome))
+            if (removerItemDesenrolada(nome))
             {
                 printf("✅ Item '%s' encontrado e removido!\n", nome);
                 printf("%s\n", LINHA);
-                listarItensVetor();
+                exibirItensDesenrolada(0);
             }
             else
             {
@@ -587,7 +3860,7 @@ void menuVetor()
         }
 
         case 3:
-            listarItensVetor();
+            listarItensDesenrolada();
             break;
 
         case 4:
@@ -596,7 +3869,7 @@ void menuVetor()
             printf("         🔍 BUSCAR ITEM 🔍\n");
             printf("%s\n", LINHA);
 
-            if (totalItensVetor == 0)
+            if (mochilaDesenrolada == NULL)
             {
                 printf("⚠️  Sua mochila está vazia! Nada para buscar.\n");
                 printf("%s\n\n", LINHA);
@@ -608,14 +3881,14 @@ void menuVetor()
             fgets(nome, sizeof(nome), stdin);
             nome[strcspn(nome, "\n")] = 0;
 
-            int resultado = buscarSequencialVetor(nome);
+            Item *resultado = buscarSequencialDesenrolada(nome);
 
-            if (resultado != -1)
+            if (resultado != NULL)
             {
                 printf("✅ Item encontrado!\n\n");
-                printf("📌 Nome: %s\n", mochilaVetor[resultado].nome);
-                printf("🏷️  Tipo: %s\n", mochilaVetor[resultado].tipo);
-                printf("📊 Quantidade: %d\n", mochilaVetor[resultado].quantidade);
+                printf("📌 Nome: %s\n", resultado->nome);
+                printf("🏷️  Tipo: %s\n", nomeDoTipo(resultado->tipo));
+                printf("📊 Quantidade: %d\n", resultado->quantidade);
             }
             else
             {
@@ -623,151 +3896,41 @@ void menuVetor()
             }
 
             printf("\n📊 Estatísticas da busca:\n");
-            printf("   Comparações realizadas: %d\n", comparacoesSequencialVetor);
-            printf("   Complexidade: O(n)\n");
+            printf("   Comparações realizadas: %d\n", comparacoesSequencialDesenrolada);
+            printf("   Complexidade: O(n), com um salto de ponteiro a cada %d itens\n", ITENS_POR_NO);
             printf("%s\n\n", LINHA);
             break;
         }
 
         case 5:
-        {
-            if (totalItensVetor == 0)
-            {
-                printf("\n⚠️  Sua mochila está vazia! Nada para ordenar.\n");
-                break;
-            }
-
-            printf("\n%s\n", LINHA);
-            printf("        ⬆️✔️ ORDENANDO ITENS ✔️⬆️\n");
-            printf("%s\n", LINHA);
-            printf("\n⏳ Ordenando itens alfabeticamente (Selection Sort)...\n");
-
-            ordenarVetor();
-
-            printf("✅ Itens ordenados com sucesso!\n");
-            printf("%s\n", LINHA);
-            listarItensVetor();
-            break;
-        }
-
-        case 6:
-        {
-            printf("\n%s\n", LINHA);
-            printf("      🔦 BUSCA BINÁRIA (RÁPIDA) 🔦\n");
-            printf("%s\n", LINHA);
-            printf("⚠️  IMPORTANTE: Os itens devem estar ORDENADOS!\n");
-            printf("   Use a opção 5 para ordenar antes.\n\n");
-
-            if (totalItensVetor == 0)
-            {
-                printf("⚠️  Sua mochila está vazia!\n");
-                printf("%s\n\n", LINHA);
-                break;
-            }
-
-            char nome[30];
-            printf("Digite o nome do item a buscar: ");
-            fgets(nome, sizeof(nome), stdin);
-            nome[strcspn(nome, "\n")] = 0;
-
-            int resultado = buscarBinariaVetor(nome);
-
-            if (resultado != -1)
-            {
-                printf("\n✅ ITEM ENCONTRADO!\n\n");
-                printf("📌 Nome: %s\n", mochilaVetor[resultado].nome);
-                printf("🏷️  Tipo: %s\n", mochilaVetor[resultado].tipo);
-                printf("📊 Quantidade: %d\n", mochilaVetor[resultado].quantidade);
-            }
-            else
-            {
-                printf("\n❌ Item '%s' não encontrado!\n", nome);
-            }
-
-            printf("\n📊 Estatísticas da busca:\n");
-            printf("   Comparações realizadas: %d\n", comparacoesBinariaVetor);
-            printf("   Complexidade: O(log n)\n");
-            printf("%s\n\n", LINHA);
-            break;
-        }
-
-        case 7:
-        {
-            printf("\n%s\n", LINHA);
-            printf("    📈 COMPARAÇÃO DE DESEMPENHO - VETOR 📈\n");
-            printf("%s\n", LINHA);
-
-            if (totalItensVetor == 0)
-            {
-                printf("⚠️  Adicione itens para comparar!\n");
-                break;
-            }
-
-            printf("\n1️⃣  BUSCA SEQUENCIAL:\n");
-            printf("   Comparações na última busca: %d\n", comparacoesSequencialVetor);
-            printf("   Complexidade: O(n)\n");
-            printf("   Melhor caso: 1 comparação\n");
-            printf("   Pior caso: %d comparações\n", totalItensVetor);
-
-            printf("\n2️⃣  BUSCA BINÁRIA (com vetor ordenado):\n");
-            printf("   Comparações na última busca: %d\n", comparacoesBinariaVetor);
-            printf("   Complexidade: O(log n)\n");
-
-            int comparacoesTeoricas = 1;
-            int temp = totalItensVetor;
-            while (temp > 1)
-            {
-                temp /= 2;
-                comparacoesTeoricas++;
-            }
-            printf("   Máx comparações teóricas: ~%d\n", comparacoesTeoricas);
-
-            printf("\n💡 CONCLUSÃO:\n");
-            if (totalItensVetor > 5)
-            {
-                printf("   A busca binária é MAIS EFICIENTE para este tamanho!\n");
-                printf("   Ganho: redução de até %d comparações.\n",
-                       comparacoesSequencialVetor - comparacoesBinariaVetor);
-            }
-            else
-            {
-                printf("   Para poucos itens, ambas são rápidas.\n");
-                printf("   Busca binária fica melhor com mais dados.\n");
-            }
-
-            printf("%s\n", LINHA);
-            break;
-        }
-
-        case 8:
             return;
 
         default:
-            printf("\n❌ Opção inválida! Digite um número entre 1 e 8.\n");
+            printf("❌ Opção inválida! Digite um número entre 1 e 5.\n");
         }
     }
 }
 
 /*
- * Função: menuLista
- * Descrição: menu de operações sobre a mochila com LISTA ENCADEADA
+ * Função: menuSkip
+ * Descrição: menu de operações sobre a mochila com SKIP LIST (ordenada por nome)
  * Parâmetros: nenhum
  * Retorno: nenhum
  */
-void menuLista()
+void menuSkip()
 {
     int opcao;
 
     while (1)
     {
         printf("\n%s\n", LINHA);
-        printf("   🎮 SISTEMA COM LISTA ENCADEADA 🎮\n");
+        printf("   🎮 SISTEMA COM SKIP LIST 🎮\n");
         printf("%s\n", LINHA);
         printf("Escolha uma opção:\n\n");
         printf("  1️⃣  - Adicionar item à mochila\n");
         printf("  2️⃣  - Remover item da mochila\n");
         printf("  3️⃣  - Listar todos os itens\n");
-        printf("  4️⃣  - Buscar item (Sequencial com contador)\n");
+        printf("  4️⃣  - Buscar item (Skip list com contador)\n");
         printf("  5️⃣  - Voltar ao menu principal\n");
         printf("%s\n", LINHA);
         printf("Digite sua opção (1-5): ");
@@ -782,7 +3945,7 @@ void menuLista()
             printf("         ➕ CADASTRAR NOVO ITEM ➕\n");
             printf("%s\n", LINHA);
 
-            if (totalItensLista >= MAX_ITENS)
+            if (totalItensSkip >= MAX_ITENS)
             {
                 printf("❌ Erro: Sua mochila está cheia! Máximo de %d itens.\n", MAX_ITENS);
                 printf("   Remova alguns itens antes de adicionar novos.\n");
@@ -812,11 +3975,19 @@ void menuLista()
                 break;
             }
 
-            if (inserirItemLista(nome, tipo, quantidade))
+            if (procurarTipo(tipo) == -1 && totalTipos == MAX_TIPOS)
+            {
+                printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
+                printf("%s\n\n", LINHA);
+                break;
+            }
+
+            if (inserirItemSkip(nome, tipo, quantidade))
             {
                 printf("✅ Item '%s' adicionado com sucesso à mochila!\n", nome);
+                printf("   Comparações realizadas: %d\n", comparacoesSkip);
                 printf("%s\n", LINHA);
-                listarItensLista();
+                exibirItensSkip(0);
             }
             else
             {
@@ -831,7 +4002,7 @@ void menuLista()
             printf("         ❌ REMOVER ITEM ❌\n");
             printf("%s\n", LINHA);
 
-            if (mochilaLista == NULL)
+            if (totalItensSkip == 0)
             {
                 printf("⚠️  Sua mochila está vazia! Nada para remover.\n");
                 printf("%s\n\n", LINHA);
@@ -843,11 +4014,12 @@ void menuLista()
             fgets(nome, sizeof(nome), stdin);
             nome[strcspn(nome, "\n")] = 0;
 
-            if (removerItemLista(nome))
+            if (removerItemSkip(nome))
             {
                 printf("✅ Item '%s' encontrado e removido!\n", nome);
+                printf("   Comparações realizadas: %d\n", comparacoesSkip);
                 printf("%s\n", LINHA);
-                listarItensLista();
+                exibirItensSkip(0);
             }
             else
             {
@@ -858,7 +4030,7 @@ void menuLista()
         }
 
         case 3:
-            listarItensLista();
+            listarItensSkip();
             break;
 
         case 4:
@@ -867,7 +4039,7 @@ void menuLista()
             printf("         🔍 BUSCAR ITEM 🔍\n");
             printf("%s\n", LINHA);
 
-            if (mochilaLista == NULL)
+            if (totalItensSkip == 0)
             {
                 printf("⚠️  Sua mochila está vazia! Nada para buscar.\n");
                 printf("%s\n\n", LINHA);
@@ -879,14 +4051,14 @@ void menuLista()
             fgets(nome, sizeof(nome), stdin);
             nome[strcspn(nome, "\n")] = 0;
 
-            No *resultado = buscarSequencialLista(nome);
+            Item *resultado = buscarItemSkip(nome);
 
             if (resultado != NULL)
             {
                 printf("✅ Item encontrado!\n\n");
-                printf("📌 Nome: %s\n", resultado->dados.nome);
-                printf("🏷️  Tipo: %s\n", resultado->dados.tipo);
-                printf("📊 Quantidade: %d\n", resultado->dados.quantidade);
+                printf("📌 Nome: %s\n", resultado->nome);
+                printf("🏷️  Tipo: %s\n", nomeDoTipo(resultado->tipo));
+                printf("📊 Quantidade: %d\n", resultado->quantidade);
             }
             else
             {
@@ -894,8 +4066,8 @@ void menuLista()
             }
 
             printf("\n📊 Estatísticas da busca:\n");
-            printf("   Comparações realizadas: %d\n", comparacoesSequencialLista);
-            printf("   Complexidade: O(n)\n");
+            printf("   Comparações realizadas: %d\n", comparacoesBuscaSkip);
+            printf("   Complexidade: O(log n) esperado (%d níveis em uso)\n", nivelSkip);
             printf("%s\n\n", LINHA);
             break;
         }
@@ -918,22 +4090,45 @@ void menuLista()
 void telaComparacao()
 {
     printf("\n%s\n", LINHA);
-    printf("   🔬 ANÁLISE COMPARATIVA: VETOR x LISTA 🔬\n");
+    printf("   🔬 ANÁLISE COMPARATIVA: VETOR x LISTAS 🔬\n");
     printf("%s\n", LINHA);
 
     printf("\n📊 DADOS COLETADOS:\n");
-    printf("   Itens no Vetor: %d/%d\n", totalItensVetor, MAX_ITENS);
-    printf("   Itens na Lista: %d/%d\n\n", totalItensLista, MAX_ITENS);
+    printf("   Itens no Vetor: ");
+    exibirContagem(totalItensVetor);
+    printf("\n   Itens na Lista: ");
+    exibirContagem(totalItensLista);
+    printf("\n   Itens na Lista Desenrolada: ");
+    exibirContagem(totalItensDesenrolada);
+    printf("\n   Itens na Skip List: ");
+    exibirContagem(totalItensSkip);
+    printf("\n\n");
 
     printf("🔍 OPERAÇÕES DE BUSCA REGISTRADAS:\n");
     printf("   Última busca sequencial (Vetor): %d comparações\n", comparacoesSequencialVetor);
     printf("   Última busca sequencial (Lista): %d comparações\n", comparacoesSequencialLista);
+    printf("   Última busca sequencial (Lista Desenrolada): %d comparações\n", comparacoesSequencialDesenrolada);
 
     if (comparacoesBinariaVetor > 0)
     {
         printf("   Última busca binária (Vetor): %d comparações\n", comparacoesBinariaVetor);
     }
 
+    if (comparacoesOrdenacaoVetor > 0)
+    {
+        printf("   Última ordenação (Vetor, Introsort): %d comparações\n", comparacoesOrdenacaoVetor);
+    }
+
+    if (comparacoesOrdenacaoLista > 0)
+    {
+        printf("   Última ordenação (Lista, Merge Sort): %d comparações\n", comparacoesOrdenacaoLista);
+    }
+
+    if (comparacoesBuscaSkip > 0)
+    {
+        printf("   Última busca na Skip List: %d comparações\n", comparacoesBuscaSkip);
+    }
+
     printf("\n%s\n", LINHA);
     printf("   💡 ANÁLISE DETALHADA POR ESTRUTURA\n");
     printf("%s\n", LINHA);
@@ -942,6 +4137,7 @@ void telaComparacao()
     printf("   ✅ Pontos positivos:\n");
     printf("      • Acesso direto por índice: O(1)\n");
     printf("      • Busca binária possível: O(log n) ⚡\n");
+    printf("      • Modo ordenado: inserção binária, sem reordenar tudo\n");
     printf("      • Cache memory friendly\n");
     printf("      • Implementação simples\n");
     printf("   ❌ Limitações:\n");
@@ -958,8 +4154,30 @@ void telaComparacao()
     printf("   ❌ Limitações:\n");
     printf("      • Acesso sequencial obrigatório: O(n)\n");
     printf("      • Sem busca binária direta\n");
+    printf("      • Ordenável só por intercalação (Merge Sort)\n");
     printf("      • Overhead de memória (ponteiros)\n");
 
+    printf("\n🔸 LISTA DESENROLADA (%d itens por nó):\n", ITENS_POR_NO);
+    printf("   ✅ Pontos positivos:\n");
+    printf("      • Inserção no final: O(1) ⚡\n");
+    printf("      • Itens contíguos dentro do nó: cache friendly\n");
+    printf("      • Um ponteiro a cada %d itens (menos overhead)\n", ITENS_POR_NO);
+    printf("      • Remoção desloca no máximo %d itens\n", ITENS_POR_NO);
+    printf("   ❌ Limitações:\n");
+    printf("      • Busca continua O(n)\n");
+    printf("      • Nós podem ficar parcialmente vazios\n");
+    printf("      • Implementação mais complexa\n");
+
+    printf("\n🔹 SKIP LIST (lista ordenada em níveis):\n");
+    printf("   ✅ Pontos positivos:\n");
+    printf("      • Busca, inserção e remoção: O(log n) esperado ⚡\n");
+    printf("      • Itens sempre ordenados por nome\n");
+    printf("      • Memória dinâmica, como a lista encadeada\n");
+    printf("   ❌ Limitações:\n");
+    printf("      • Em média 2 ponteiros por nó\n");
+    printf("      • Desempenho depende de sorteio (não garantido)\n");
+    printf("      • Inserção no final deixa de ser O(1)\n");
+
     printf("\n%s\n", LINHA);
     printf("   🎯 QUANDO USAR CADA UMA?\n");
     printf("%s\n", LINHA);
@@ -976,18 +4194,28 @@ void telaComparacao()
     printf("   • Memória é limitada/escassa\n");
     printf("   • Acesso sequencial é suficiente\n");
 
+    printf("\n📍 Use LISTA DESENROLADA quando:\n");
+    printf("   • Há muitas inserções E muitas leituras sequenciais\n");
+    printf("   • O inventário é grande (cache importa)\n");
+
+    printf("\n📍 Use SKIP LIST quando:\n");
+    printf("   • Buscas por nome são frequentes\n");
+    printf("   • Os itens mudam o tempo todo e precisam ficar ordenados\n");
+
     printf("\n%s\n", LINHA);
     printf("   📊 RESUMO DO APRENDIZADO\n");
     printf("%s\n\n", LINHA);
 
     printf("Cada estrutura tem seu propósito:\n");
     printf("➜ VETOR: melhor para LEITURA e BUSCA rápida\n");
-    printf("➜ LISTA: melhor para MODIFICAÇÕES dinâmicas\n\n");
+    printf("➜ LISTA: melhor para MODIFICAÇÕES dinâmicas\n");
+    printf("➜ LISTA DESENROLADA: meio-termo entre as duas\n");
+    printf("➜ SKIP LIST: busca rápida sem abrir mão da lista\n\n");
 }
 
 /*
  * Função: menuPrincipal
- * Descrição: menu principal que permite escolher entre vetor e lista
+ * Descrição: menu principal que permite escolher a estrutura de dados
  * Parâmetros: nenhum
  * Retorno: nenhum
  */
@@ -1000,10 +4228,13 @@ int menuPrincipal()
     printf("\nEscolha a estrutura de dados para gerenciar sua mochila:\n\n");
     printf("  1️⃣  - Usar VETOR (Lista Sequencial)\n");
     printf("  2️⃣  - Usar LISTA ENCADEADA\n");
-    printf("  3️⃣  - Ver análise comparativa\n");
-    printf("  4️⃣  - Sair do jogo\n");
+    printf("  3️⃣  - Usar LISTA DESENROLADA\n");
+    printf("  4️⃣  - Usar SKIP LIST (ordenada por nome)\n");
+    printf("  5️⃣  - Ver análise comparativa\n");
+    printf("  6️⃣  - Benchmark vetor x lista (CSV/JSON)\n");
+    printf("  7️⃣  - Sair do jogo\n");
     printf("%s\n", LINHA);
-    printf("Digite sua opção (1-4): ");
+    printf("Digite sua opção (1-7): ");
 
     int opcao;
     scanf("%d", &opcao);
@@ -1016,16 +4247,106 @@ int menuPrincipal()
  * FUNÇÃO PRINCIPAL
  * ======================================== */
 
-int main()
+int main(int argc, char *argv[])
 {
+    int modoBenchmark = 0;
+    int formatoJson = 0;
+    long long maximoBenchmark = 1000000;
+    const char *arquivoSaida = NULL;
+    const char *arquivoSnapshot = NULL;
+
+    // Interpreta os argumentos da linha de comando
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--benchmark") == 0)
+        {
+            modoBenchmark = 1;
+        }
+        else if (strcmp(argv[i], "--max") == 0 && i + 1 < argc)
+        {
+            maximoBenchmark = atoll(argv[++i]);
+            if (maximoBenchmark < 10 || maximoBenchmark > MAXIMO_BENCHMARK)
+            {
+                fprintf(stderr, "Erro: --max deve estar entre 10 e %d\n", MAXIMO_BENCHMARK);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--json") == 0)
+        {
+            formatoJson = 1;
+        }
+        else if (strcmp(argv[i], "--saida") == 0 && i + 1 < argc)
+        {
+            arquivoSaida = argv[++i];
+        }
+        else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+        {
+            arquivoSnapshot = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Uso: %s [--snapshot arquivo] [--benchmark [--max N] [--json] [--saida arquivo]]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    // Modo benchmark: só a saída CSV/JSON, sem menus
+    if (modoBenchmark)
+    {
+        FILE *saida = stdout;
+
+        if (arquivoSaida != NULL)
+        {
+            saida = fopen(arquivoSaida, "w");
+            if (saida == NULL)
+            {
+                fprintf(stderr, "Erro: não foi possível criar '%s'\n", arquivoSaida);
+                return 1;
+            }
+        }
+
+        int concluiu = executarBenchmark(maximoBenchmark, saida, formatoJson);
+
+        if (saida != stdout)
+        {
+            fclose(saida);
+        }
+
+        if (!concluiu)
+        {
+            fprintf(stderr, "Erro: memória insuficiente para N = %lld\n", maximoBenchmark);
+            return 1;
+        }
+        return 0;
+    }
+
     printf("\n╔════════════════════════════════════════════════════╗\n");
     printf("║  BEM-VINDO AO FREE FIRE - NÍVEL AVENTUREIRO 📦    ║\n");
     printf("║     Compare Vetores vs Listas Encadeadas!          ║\n");
     printf("║   Organize seus itens e sobreviva no jogo!         ║\n");
     printf("╚════════════════════════════════════════════════════╝\n");
 
+    if (arquivoSnapshot != NULL)
+    {
+        int carregado = carregarSnapshot(arquivoSnapshot);
+
+        if (carregado == -1)
+        {
+            fprintf(stderr, "Erro: snapshot '%s' inválido: %s\n", arquivoSnapshot, motivoSnapshot);
+            return 1;
+        }
+        if (carregado == 1)
+        {
+            printf("\n📂 Snapshot '%s' carregado: %d itens no vetor%s.\n", arquivoSnapshot,
+                   totalItensVetor, vetorOrdenado ? " (ordenados por nome)" : "");
+        }
+    }
+
     int opcao;
 
+    srand((unsigned)time(NULL)); // Sorteio dos níveis da skip list
+
     while (1)
     {
         opcao = menuPrincipal();
@@ -1041,21 +4362,48 @@ int main()
             break;
 
         case 3:
-            telaComparacao();
+            menuListaDesenrolada();
             break;
 
         case 4:
+            menuSkip();
+            break;
+
+        case 5:
+            telaComparacao();
+            break;
+
+        case 6:
+            telaBenchmark();
+            break;
+
+        case 7:
+            if (arquivoSnapshot != NULL && vetorAlterado)
+            {
+                if (!salvarSnapshot(arquivoSnapshot))
+                {
+                    printf("\n❌ Erro: não foi possível gravar o snapshot '%s'.\n", arquivoSnapshot);
+                    break;
+                }
+                printf("\n💾 Vetor gravado em '%s' (%d itens).\n", arquivoSnapshot, totalItensVetor);
+            }
             printf("\n╔════════════════════════════════════════════════════╗\n");
             printf("║    👋 OBRIGADO POR JOGAR! ATÉ A PRÓXIMA! 👋       ║\n");
             printf("╚════════════════════════════════════════════════════╝\n\n");
+            liberarVetor();
             liberarLista();
+            liberarDesenrolada();
+            liberarSkip();
             return 0;
 
         default:
-            printf("\n❌ Opção inválida! Digite um número entre 1 e 4.\n");
+            printf("\n❌ Opção inválida! Digite um número entre 1 e 7.\n");
         }
     }
 
+    liberarVetor();
     liberarLista();
+    liberarDesenrolada();
+    liberarSkip();
     return 0;
 }
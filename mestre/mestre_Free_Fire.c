@@ -14,19 +14,59 @@
  * - 3 Algoritmos de ORDENAÇÃO diferentes:
  *   → Bubble Sort (ordena por NOME)
  *   → Insertion Sort (ordena por TIPO)
- *   → Selection Sort (ordena por PRIORIDADE)
- * - Busca binária para encontrar componente-chave
+ *   → Counting Sort (ordena por PRIORIDADE em O(n + k), estável)
+ * - Motor de ordenação: qualquer algoritmo com qualquer chave (nome,
+ *   tipo, prioridade, quantidade ou composta), com chaves extraídas
+ *   uma única vez (decorar-ordenar-desdecorar)
+ * - Dicionário de tipos: cada componente guarda só o número do seu
+ *   tipo, e ordenar por tipo compara inteiros (posição alfabética)
+ * - Ordenação por índices: ordena um vetor de int e aplica a
+ *   permutação uma única vez (ou só lê através dela), com contagem
+ *   de bytes movidos
+ * - Busca binária para encontrar componente-chave, sobre índices
+ *   por nome, tipo e prioridade mantidos a cada inserção/remoção
+ * - Remoção por lápide com compactação tardia (O(1) amortizado)
+ * - Handles geracionais para usar componentes sem buscar pelo nome
+ * - Listagem paginada com saída bufferizada
  * - Medição de desempenho (comparações e tempo)
  * - Análise comparativa de algoritmos
+ * - Merge Sort paralelo com pool de threads e relatório de
+ *   escalabilidade (1..N threads)
+ * - Benchmark de ordenação: todos os algoritmos, mesma chave,
+ *   distribuições geradas e N = 10 até 10^6, em CSV ou JSON
+ * - Snapshot binário da torre (--snapshot arquivo): registros de
+ *   tamanho fixo lidos na abertura e gravados ao sair
+ *
+ * Compilação: gcc mestre_Free_Fire.c -o mestre -pthread -lm
+ * Uso: mestre [--snapshot arquivo] [--benchmark [--max N] [--chave texto|inteira] [--json] [--saida arquivo]]
  *
  * Autor: Estrutura de Dados - Nível Mestre
  * Data: 2026
  */
 
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // clock_gettime, fsync, fileno
+#endif
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <time.h>
+#include <math.h>
+#include <errno.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h> // QueryPerformanceCounter, GetSystemInfo
+#else
+#include <unistd.h> // sysconf, fsync, write
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // comparação de textos de 16 em 16 bytes
+#define USAR_SSE2 1
+#endif
 
 /* ========================================
  * DEFINIÇÃO DE STRUCTS
@@ -35,11 +75,208 @@
 typedef struct
 {
     char nome[30];
-    char tipo[20];
+    unsigned char tipo; // número do tipo no dicionário de tipos
     int prioridade; // 1 a 10
     int quantidade; // quantidade do componente
+    char removido;  // 1 = lápide (aguardando compactação)
+    int slot;       // entrada do mapa de slots que aponta para este componente
+    unsigned long long prefixoNome; // 8 primeiros bytes de nome (big-endian)
 } Componente;
 
+/*
+ * Handle: referência estável para um componente
+ * - slot: entrada no mapa de slots
+ * - geracao: versão do slot na emissão; muda quando o componente sai
+ */
+typedef struct
+{
+    int slot;
+    unsigned int geracao;
+} Handle;
+
+/*
+ * SlotComponente: entrada do mapa de slots
+ * - posicao: posição atual do componente em torre (ou SLOT_LIVRE)
+ * - geracao: incrementada a cada liberação do slot
+ * - proximoLivre: encadeia os slots livres
+ */
+typedef struct
+{
+    int posicao;
+    unsigned int geracao;
+    int proximoLivre;
+} SlotComponente;
+
+/*
+ * AlgoritmoOrdenacao / ChaveOrdenacao: escolhidos de forma independente
+ * no motor de ordenação. A chave composta é prioridade (decrescente)
+ * com desempate por nome.
+ */
+typedef enum
+{
+    ALGORITMO_BUBBLE,
+    ALGORITMO_INSERTION,
+    ALGORITMO_SELECTION,
+    ALGORITMO_CONTAGEM, // só para chaves inteiras de domínio pequeno
+    ALGORITMO_MERGE,
+    ALGORITMO_PARALELO, // Merge Sort com threadsOrdenacao threads
+    TOTAL_ALGORITMOS,
+    ALGORITMO_AUTOMATICO // o motor escolhe pelo tipo e domínio da chave
+} AlgoritmoOrdenacao;
+
+typedef enum
+{
+    CHAVE_NOME,
+    CHAVE_TIPO,
+    CHAVE_PRIORIDADE,
+    CHAVE_QUANTIDADE,
+    CHAVE_COMPOSTA,
+    TOTAL_CHAVES
+} ChaveOrdenacao;
+
+/*
+ * ModoOrdenacao: o que os algoritmos movem durante a ordenação
+ * - MODO_REGISTROS: os próprios Componente (como antes do motor)
+ * - MODO_DECORADO: registros ElementoOrdenacao (chave + origem)
+ * - MODO_INDICES: só um int por componente; as chaves ficam paradas
+ */
+typedef enum
+{
+    MODO_REGISTROS,
+    MODO_DECORADO,
+    MODO_INDICES,
+    TOTAL_MODOS
+} ModoOrdenacao;
+
+/*
+ * ElementoOrdenacao: chave já extraída de um componente
+ * - prefixo: 8 primeiros bytes de texto como inteiro big-endian
+ * - numero: parte numérica, comparada primeiro (0 se a chave não tem)
+ * - texto: parte textual (nome), comparada no empate
+ * - origem: posição do componente em torre
+ */
+typedef struct
+{
+    unsigned long long prefixo;
+    int numero;
+    char texto[30];
+    int origem;
+} ElementoOrdenacao;
+
+/*
+ * ContextoOrdenacao: o que os algoritmos genéricos precisam saber
+ * - tamanho: bytes de cada elemento do vetor ordenado
+ * - comparar: função de comparação (como a do qsort)
+ * - chaveInteira: extrai a chave como inteiro, ou NULL se a chave tem
+ *   parte textual (nesse caso não há Counting Sort)
+ * - comparacoes: comparações feitas nesta ordenação
+ * - bytesMovidos: bytes copiados entre posições do vetor (trocas,
+ *   deslocamentos e cópias para a chave temporária)
+ */
+typedef struct
+{
+    size_t tamanho;
+    int (*comparar)(const void *, const void *);
+    int (*chaveInteira)(const void *);
+    long long comparacoes;
+    long long bytesMovidos;
+} ContextoOrdenacao;
+
+/*
+ * EstatisticasTempo: resumo de várias medições do mesmo algoritmo
+ * - execucoes: medições consideradas (sem contar o aquecimento)
+ * - minimo, mediana, p90, p99: percentis dos tempos, em segundos
+ * - media, desvio: média e desvio padrão amostral
+ */
+typedef struct
+{
+    int execucoes;
+    double minimo;
+    double mediana;
+    double p90;
+    double p99;
+    double media;
+    double desvio;
+} EstatisticasTempo;
+
+/*
+ * BlocoAvulso: pedido que não coube na arena (malloc próprio); os
+ * dados vêm logo após o cabeçalho.
+ * - escopo: escopos abertos quando foi reservado (liberado ao fechar)
+ * - bytes: tamanho dos dados
+ */
+typedef struct BlocoAvulso
+{
+    struct BlocoAvulso *proximo;
+    int escopo;
+    size_t bytes;
+} BlocoAvulso;
+
+/*
+ * ArenaOrdenacao: memória de rascunho reaproveitada pelas ordenações
+ * - bloco, capacidade, usado: região contígua e quanto dela está em uso
+ * - avulsos, bytesAvulsos: pedidos que não couberam no bloco (pilha)
+ * - transbordou: houve avulsos desde o último crescimento do bloco
+ * - pico: maior uso simultâneo (bloco + avulsos) já visto
+ * - escoposAbertos: marcas ainda não devolvidas com liberarArena
+ * - reservas, alocacoesHeap: pedidos atendidos e mallocs feitos
+ */
+typedef struct
+{
+    char *bloco;
+    size_t capacidade;
+    size_t usado;
+    BlocoAvulso *avulsos;
+    size_t bytesAvulsos;
+    int transbordou;
+    size_t pico;
+    int escoposAbertos;
+    long long reservas;
+    long long alocacoesHeap;
+} ArenaOrdenacao;
+
+/*
+ * TarefaOrdenacao: unidade de trabalho da ordenação paralela
+ * - intercalar: 0 = ordenar o bloco [inicioA, fimA) de destino,
+ *   1 = intercalar origem[inicioA, fimA) com origem[inicioB, fimB)
+ *   em destino a partir de posicaoDestino
+ * - auxiliar: área de rascunho do bloco (mesmas posições do bloco)
+ * - contexto: cópia própria do contexto, com contadores da tarefa
+ */
+typedef struct
+{
+    int intercalar;
+    const void *origem;
+    void *destino;
+    void *auxiliar;
+    int inicioA, fimA;
+    int inicioB, fimB;
+    int posicaoDestino;
+    ContextoOrdenacao contexto;
+} TarefaOrdenacao;
+
+/*
+ * PoolOrdenacao: threads que executam as tarefas de uma rodada
+ * - fila: tarefas da rodada atual; proximaTarefa é a próxima livre
+ * - pendentes: tarefas ainda não concluídas
+ * - encerrar: pede o fim das threads
+ */
+#define MAXIMO_THREADS 64
+
+typedef struct
+{
+    pthread_t threads[MAXIMO_THREADS];
+    int totalThreads;
+    pthread_mutex_t trava;
+    pthread_cond_t haTarefa;
+    pthread_cond_t rodadaConcluida;
+    TarefaOrdenacao *fila;
+    int proximaTarefa;
+    int totalTarefas;
+    int pendentes;
+    int encerrar;
+} PoolOrdenacao;
+
 /* ========================================
  * CONSTANTES E VARIÁVEIS GLOBAIS
  * ======================================== */
@@ -47,475 +284,2929 @@ typedef struct
 #define MAX_COMPONENTES 20
 #define LINHA "=================================================="
 
+#define FRACAO_MAXIMA_LAPIDES 4 // Compacta quando mais de 1/4 das posições são lápides
+
 Componente torre[MAX_COMPONENTES];
-int totalComponentes = 0;
+int totalComponentes = 0;     // Componentes ativos na torre
+int posicoesTorre = 0;        // Posições usadas em torre (ativos + lápides)
+int componentesRemovidos = 0; // Lápides ainda não compactadas
+
+// Mapa de slots: há no máximo um slot por componente ativo
+#define SLOT_LIVRE -1
+
+SlotComponente slotsTorre[MAX_COMPONENTES];
+int totalSlots = 0;
+int primeiroSlotLivre = -1;
 
 // Contadores de comparações para análise de desempenho
 int comparacoesBubble = 0;
 int comparacoesInsertion = 0;
 int comparacoesSelection = 0;
 
-// Flags para controlar estado da ordenação
-int ordenadoPorNome = 0;
-int ordenadoPorTipo = 0;
-int ordenadoPorPrioridade = 0;
+// Índices secundários: slots em ordem de nome, tipo e prioridade.
+// As três primeiras chaves do motor (CHAVE_NOME, CHAVE_TIPO e
+// CHAVE_PRIORIDADE) servem de linha da matriz.
+#define TOTAL_INDICES 3
+
+int indicesTorre[TOTAL_INDICES][MAX_COMPONENTES];
 
 /* ========================================
- * FUNÇÕES AUXILIARES
+ * PROTÓTIPOS
  * ======================================== */
 
+void exibirComponentes(int interativo);
+void mergeSortParalelo(void *base, int n, ContextoOrdenacao *contexto, int threads);
+void extrairChave(const Componente *componente, ChaveOrdenacao chave, int *numero,
+                  unsigned long long *prefixo, const char **texto);
+int compararChaves(int numeroA, unsigned long long prefixoA, const char *textoA,
+                   int numeroB, unsigned long long prefixoB, const char *textoB, size_t largura);
+
+/* ========================================
+ * DICIONÁRIO DE TIPOS
+ * ========================================
+ *
+ * Os componentes repetem poucos tipos (controle, suporte, propulsão...),
+ * então cada nome de tipo fica guardado uma vez aqui e o Componente
+ * leva só o número dele. O número segue a ordem de criação e nunca
+ * muda; ordemTipos guarda a posição alfabética de cada tipo, que é a
+ * chave usada para ordenar por tipo: comparar dois tipos vira comparar
+ * dois inteiros, e o Counting Sort passa a valer para essa chave.
+ *
+ * Criar um tipo só desloca a posição dos que vêm depois dele, então a
+ * ordem relativa dos tipos existentes (e os índices secundários) não
+ * muda. Tipos não são apagados: o dicionário só cresce, até MAX_TIPOS.
+ */
+
+#define MAX_TIPOS 256   // números de tipo cabem em um unsigned char
+#define TAMANHO_TIPO 20 // maior nome de tipo, com o '\0'
+
+char nomesTipos[MAX_TIPOS][TAMANHO_TIPO]; // Nome de cada tipo, pelo número
+unsigned char ordemTipos[MAX_TIPOS];      // Posição alfabética de cada tipo
+int totalTipos = 0;                       // Tipos já criados
+
+/*
+ * Função: procurarTipo
+ * Descrição: procura um tipo no dicionário sem criá-lo
+ * Parâmetros: nome do tipo (truncado como ao guardar)
+ * Retorno: número do tipo ou -1 se não existe
+ */
+int procurarTipo(const char *tipo)
+{
+    char nome[TAMANHO_TIPO];
+    snprintf(nome, sizeof(nome), "%s", tipo);
+
+    for (int i = 0; i < totalTipos; i++)
+    {
+        if (strcmp(nomesTipos[i], nome) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
 /*
- * Função: copiarComponentes
- * Descrição: copia os componentes para um vetor temporário
- * Parâmetros: vetor origem
- * Retorno: vetor cópia
+ * Função: internarTipo
+ * Descrição: devolve o número de um tipo, criando-o se for novo
+ * Parâmetros: nome do tipo (truncado em TAMANHO_TIPO - 1 caracteres)
+ * Retorno: número do tipo ou -1 se o dicionário está cheio
  *
- * Importante: usado para não modificar dados originais
+ * Complexidade: O(t) comparações de texto, t = tipos existentes; é o
+ * único lugar onde nomes de tipo são comparados.
  */
-Componente *copiarComponentes(Componente src[])
+int internarTipo(const char *tipo)
 {
-    Componente *copia = (Componente *)malloc(totalComponentes * sizeof(Componente));
-    for (int i = 0; i < totalComponentes; i++)
+    int numero = procurarTipo(tipo);
+
+    if (numero != -1 || totalTipos == MAX_TIPOS)
+    {
+        return numero;
+    }
+
+    // Resto zerado: o dicionário vai para o snapshot como está
+    numero = totalTipos++;
+    memset(nomesTipos[numero], 0, TAMANHO_TIPO);
+    memcpy(nomesTipos[numero], tipo, strnlen(tipo, TAMANHO_TIPO - 1));
+
+    // O novo tipo fica depois dos menores; os maiores andam uma posição
+    int ordem = 0;
+    for (int i = 0; i < numero; i++)
     {
-        copia[i] = src[i];
+        if (strcmp(nomesTipos[i], nomesTipos[numero]) < 0)
+        {
+            ordem++;
+        }
+        else
+        {
+            ordemTipos[i]++;
+        }
     }
-    return copia;
+    ordemTipos[numero] = (unsigned char)ordem;
+
+    return numero;
 }
 
 /*
- * Função: trocar
- * Descrição: troca dois componentes de posição
- * Parâmetros: dois ponteiros para Componente
- * Retorno: nenhum
+ * Função: nomeDoTipo
+ * Descrição: converte o número de um tipo no seu nome
+ * Parâmetros: número do tipo
+ * Retorno: nome do tipo ("?" se o número não existe no dicionário)
  */
-void trocar(Componente *a, Componente *b)
+const char *nomeDoTipo(int numero)
 {
-    Componente temp = *a;
-    *a = *b;
-    *b = temp;
+    return numero >= 0 && numero < totalTipos ? nomesTipos[numero] : "?";
+}
+
+/*
+ * Função: ordemDoTipo
+ * Descrição: posição alfabética de um tipo entre os do dicionário
+ * Parâmetros: número do tipo
+ * Retorno: 0 para o primeiro em ordem alfabética (MAX_TIPOS se o
+ *          número não existe, o que o põe depois de todos)
+ */
+int ordemDoTipo(int numero)
+{
+    return numero >= 0 && numero < totalTipos ? ordemTipos[numero] : MAX_TIPOS;
 }
 
 /* ========================================
- * OPERAÇÕES BÁSICAS
- * ======================================== */
+ * MAPA DE SLOTS (HANDLES GERACIONAIS)
+ * ========================================
+ *
+ * Cada componente aponta para um slot, e o slot guarda a posição atual
+ * do componente. Ordenações e compactações movem os componentes e
+ * depois corrigem os slots; quem tem o handle acessa o componente em
+ * O(1), sem busca por nome. Slots liberados mudam de geração, então
+ * handles de componentes removidos são recusados.
+ */
 
 /*
- * Função: adicionarComponente
- * Descrição: adiciona um novo componente à torre
- * Parâmetros: nenhum
- * Retorno: nenhum
+ * Função: alocarSlot
+ * Descrição: reserva um slot para a posição informada
+ * Parâmetros: posição do componente em torre
+ * Retorno: handle do novo slot
  */
-void adicionarComponente()
+Handle alocarSlot(int posicao)
 {
-    printf("\n%s\n", LINHA);
-    printf("      ➕ ADICIONAR COMPONENTE À TORRE ➕\n");
-    printf("%s\n", LINHA);
+    int slot = primeiroSlotLivre;
 
-    if (totalComponentes >= MAX_COMPONENTES)
+    if (slot != -1)
     {
-        printf("❌ Erro: Torre cheia! Máximo de %d componentes.\n", MAX_COMPONENTES);
-        printf("%s\n\n", LINHA);
-        return;
+        primeiroSlotLivre = slotsTorre[slot].proximoLivre;
+    }
+    else
+    {
+        slot = totalSlots++;
+        slotsTorre[slot].geracao = 1;
     }
 
-    printf("Digite o nome do componente: ");
-    fgets(torre[totalComponentes].nome, sizeof(torre[totalComponentes].nome), stdin);
-    torre[totalComponentes].nome[strcspn(torre[totalComponentes].nome, "\n")] = 0;
-
-    printf("Digite o tipo (controle/suporte/propulsão/etc): ");
-    fgets(torre[totalComponentes].tipo, sizeof(torre[totalComponentes].tipo), stdin);
-    torre[totalComponentes].tipo[strcspn(torre[totalComponentes].tipo, "\n")] = 0;
+    slotsTorre[slot].posicao = posicao;
 
-    printf("Digite a prioridade (1-10): ");
-    scanf("%d", &torre[totalComponentes].prioridade);
-    getchar();
+    Handle handle = {slot, slotsTorre[slot].geracao};
+    return handle;
+}
 
-    printf("Digite a quantidade: ");
-    scanf("%d", &torre[totalComponentes].quantidade);
-    getchar();
+/*
+ * Função: liberarSlot
+ * Descrição: devolve o slot à lista de livres e invalida seus handles
+ * Parâmetros: slot
+ * Retorno: nenhum
+ */
+void liberarSlot(int slot)
+{
+    slotsTorre[slot].posicao = SLOT_LIVRE;
+    slotsTorre[slot].geracao++;
+    slotsTorre[slot].proximoLivre = primeiroSlotLivre;
+    primeiroSlotLivre = slot;
+}
 
-    if (torre[totalComponentes].prioridade < 1 || torre[totalComponentes].prioridade > 10)
+/*
+ * Função: resolverHandle
+ * Descrição: converte um handle na posição atual do componente
+ * Parâmetros: handle
+ * Retorno: posição em torre ou -1 se o handle não é (mais) válido
+ */
+int resolverHandle(Handle handle)
+{
+    if (handle.slot < 0 || handle.slot >= totalSlots)
     {
-        printf("❌ Erro: Prioridade deve estar entre 1 e 10!\n");
-        printf("%s\n\n", LINHA);
-        return;
+        return -1;
     }
 
-    if (torre[totalComponentes].quantidade <= 0)
+    if (slotsTorre[handle.slot].posicao == SLOT_LIVRE ||
+        slotsTorre[handle.slot].geracao != handle.geracao)
     {
-        printf("❌ Erro: A quantidade deve ser maior que zero!\n");
-        printf("%s\n\n", LINHA);
-        return;
+        return -1;
     }
 
-    totalComponentes++;
-    printf("✅ Componente '%s' adicionado com sucesso à torre!\n", torre[totalComponentes - 1].nome);
-    printf("%s\n", LINHA);
-
-    // Reseta flags de ordenação
-    ordenadoPorNome = 0;
-    ordenadoPorTipo = 0;
-    ordenadoPorPrioridade = 0;
-
-    // Exibe a listagem atualizada
-    listarComponentes();
+    return slotsTorre[handle.slot].posicao;
 }
 
 /*
- * Função: removerComponente
- * Descrição: remove um componente pelo nome
+ * Função: atualizarSlots
+ * Descrição: recalcula a posição de todos os slots após reordenar torre
  * Parâmetros: nenhum
  * Retorno: nenhum
+ *
+ * Complexidade: O(n), executada uma vez ao final de cada ordenação
  */
-void removerComponente()
+void atualizarSlots()
 {
-    printf("\n%s\n", LINHA);
-    printf("      ❌ REMOVER COMPONENTE ❌\n");
-    printf("%s\n", LINHA);
+    for (int i = 0; i < posicoesTorre; i++)
+    {
+        if (!torre[i].removido)
+        {
+            slotsTorre[torre[i].slot].posicao = i;
+        }
+    }
+}
 
-    if (totalComponentes == 0)
+/* ========================================
+ * CHAVES DE TEXTO (PREFIXO INTEIRO + SSE2)
+ * ========================================
+ *
+ * Os 8 primeiros bytes de nome e tipo são guardados como um inteiro
+ * big-endian, calculado uma vez quando o componente entra na torre.
+ * Comparar dois prefixos dá a mesma ordem que strcmp nesses 8 bytes,
+ * então a maioria das comparações termina com uma comparação inteira.
+ * Só nos empates o resto do texto é comparado, 16 bytes por vez com
+ * SSE2 (ou byte a byte, sem SSE2).
+ */
+
+/*
+ * Função: prefixoTexto
+ * Descrição: calcula o prefixo inteiro de um texto
+ * Parâmetros: texto terminado em '\0'
+ * Retorno: 8 primeiros bytes em big-endian (zeros após o fim do texto)
+ */
+unsigned long long prefixoTexto(const char *texto)
+{
+    unsigned long long prefixo = 0;
+    int terminou = 0;
+
+    for (int i = 0; i < 8; i++)
     {
-        printf("⚠️  Torre vazia! Nada para remover.\n");
-        printf("%s\n\n", LINHA);
-        return;
+        terminou = terminou || texto[i] == '\0';
+        prefixo = (prefixo << 8) | (terminou ? 0u : (unsigned char)texto[i]);
     }
 
-    char nome[30];
-    printf("Nome do componente a remover: ");
-    fgets(nome, sizeof(nome), stdin);
-    nome[strcspn(nome, "\n")] = 0;
+    return prefixo;
+}
 
-    int indice = -1;
-    for (int i = 0; i < totalComponentes; i++)
+/*
+ * Função: primeiroBit
+ * Descrição: posição do bit 1 menos significativo
+ * Parâmetros: máscara diferente de zero
+ * Retorno: posição (0 a 31)
+ */
+int primeiroBit(unsigned int mascara)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(mascara);
+#else
+    int posicao = 0;
+    while (!(mascara & 1u))
     {
-        if (strcmp(torre[i].nome, nome) == 0)
-        {
-            indice = i;
-            break;
-        }
+        mascara >>= 1;
+        posicao++;
     }
+    return posicao;
+#endif
+}
 
-    if (indice != -1)
+/*
+ * Função: compararRestoTexto
+ * Descrição: compara dois textos a partir do 9º byte
+ * Parâmetros: dois textos cujos 8 primeiros bytes são iguais e não
+ *             nulos, e a largura do campo que os contém
+ * Retorno: <0, 0 ou >0 (mesmo sinal de strcmp)
+ *
+ * Com SSE2, compara blocos de 16 bytes e procura, de uma vez, o
+ * primeiro byte diferente ou o fim do texto. O último bloco é recuado
+ * para terminar no fim do campo, então nunca lê além dele; os bytes
+ * repetidos já foram vistos iguais e não nulos.
+ */
+int compararRestoTexto(const char *a, const char *b, size_t largura)
+{
+    size_t i = 8;
+
+#ifdef USAR_SSE2
+    if (largura >= 16)
     {
-        printf("✅ Componente '%s' removido!\n", nome);
+        const __m128i zero = _mm_setzero_si128();
 
-        for (int i = indice; i < totalComponentes - 1; i++)
+        while (i < largura)
         {
-            torre[i] = torre[i + 1];
-        }
-        totalComponentes--;
-        printf("%s\n", LINHA);
+            size_t bloco = (i + 16 <= largura) ? i : largura - 16;
+            __m128i x = _mm_loadu_si128((const __m128i *)(a + bloco));
+            __m128i y = _mm_loadu_si128((const __m128i *)(b + bloco));
+
+            unsigned int diferentes = ~(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) & 0xFFFFu;
+            unsigned int fim = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero));
 
-        listarComponentes();
+            if (diferentes | fim)
+            {
+                size_t k = bloco + primeiroBit(diferentes | fim);
+                return (unsigned char)a[k] - (unsigned char)b[k];
+            }
+
+            i = bloco + 16;
+        }
 
-        // Reseta flags de ordenação
-        ordenadoPorNome = 0;
-        ordenadoPorTipo = 0;
-        ordenadoPorPrioridade = 0;
+        return 0;
     }
-    else
+#endif
+
+    for (; i < largura; i++)
     {
-        printf("❌ Componente '%s' não encontrado!\n", nome);
-        printf("%s\n\n", LINHA);
+        if (a[i] != b[i] || a[i] == '\0')
+        {
+            return (unsigned char)a[i] - (unsigned char)b[i];
+        }
     }
+
+    return 0;
 }
 
 /*
- * Função: listarComponentes
- * Descrição: exibe todos os componentes em formato tabular
- * Parâmetros: nenhum
- * Retorno: nenhum
+ * Função: compararTextos
+ * Descrição: compara dois textos usando primeiro os prefixos
+ * Parâmetros: prefixo e texto de cada lado e largura dos campos
+ * Retorno: <0, 0 ou >0 (mesmo sinal de strcmp)
  */
-void listarComponentes()
+int compararTextos(unsigned long long prefixoA, const char *a,
+                   unsigned long long prefixoB, const char *b, size_t largura)
 {
-    printf("\n%s\n", LINHA);
-    printf("      📦 COMPONENTES DA TORRE 📦\n");
-    printf("%s\n", LINHA);
-
-    if (totalComponentes == 0)
+    if (prefixoA != prefixoB)
     {
-        printf("⚠️  Torre vazia! Adicione componentes para começar.\n");
-        printf("%s\n\n", LINHA);
-        return;
+        return prefixoA < prefixoB ? -1 : 1;
     }
 
-    printf("Total de componentes: %d/%d\n\n", totalComponentes, MAX_COMPONENTES);
-
-    printf("┌────┬──────────────────────────┬─────────────┬────────────┬────────────┐\n");
-    printf("│ #  │ Nome                     │ Tipo        │ Prioridade │ Quantidade │\n");
-    printf("├────┼──────────────────────────┼─────────────┼────────────┼────────────┤\n");
-
-    for (int i = 0; i < totalComponentes; i++)
+    // Prefixos iguais com byte nulo: os dois textos acabaram juntos
+    if ((prefixoA & 0xFFu) == 0)
     {
-        printf("│ %2d │ %-24s  │ %-11s   │ %10d  │ %10d  │\n",
-               i + 1,
-               torre[i].nome,
-               torre[i].tipo,
-               torre[i].prioridade,
-               torre[i].quantidade);
+        return 0;
     }
 
-    printf("└────┴──────────────────────────┴─────────────┴────────────┴────────────┘\n\n");
+    return compararRestoTexto(a, b, largura);
 }
 
 /* ========================================
- * ALGORITMOS DE ORDENAÇÃO COM CONTADORES
- * ======================================== */
+ * ÍNDICES SECUNDÁRIOS (NOME, TIPO, PRIORIDADE)
+ * ========================================
+ *
+ * Cada índice guarda os slots dos componentes ativos em ordem de uma
+ * chave e é atualizado a cada inserção e remoção (busca binária +
+ * deslocamento). Como guarda slots e não posições, ordenar ou compactar
+ * torre não invalida nenhum índice: a busca binária e a listagem
+ * ordenada ficam sempre disponíveis, sem reordenar.
+ */
 
 /*
- * Função: bubbleSortNome
- * Descrição: ordena componentes por NAME usando Bubble Sort
- * Parâmetros: nenhum
- * Retorno: nenhum
- *
- * Complexidade: O(n²)
- * Melhor caso: O(n) - já ordenado
- * Pior caso: O(n²) - ordem reversa
+ * Função: componenteDoSlot
+ * Descrição: componente apontado por um slot ocupado
+ * Parâmetros: slot
+ * Retorno: ponteiro para o componente em torre
+ */
+Componente *componenteDoSlot(int slot)
+{
+    return &torre[slotsTorre[slot].posicao];
+}
+
+/*
+ * Função: limiteIndice
+ * Descrição: busca binária da posição de um componente em um índice
+ * Parâmetros: índice (chave), componente de referência, entradas do
+ *             índice, 1 para o limite superior (depois dos iguais) ou 0
+ *             para o inferior, e contador de comparações (pode ser NULL)
+ * Retorno: posição no índice
  *
- * Como funciona:
- * - Compara elementos adjacentes
- * - Troca se estiverem na ordem errada
- * - Repete até não haver mais trocas
+ * Inserir no limite superior mantém os empates na ordem de chegada.
  */
-void bubbleSortNome()
+int limiteIndice(ChaveOrdenacao chave, const Componente *componente, int entradas, int superior, int *comparacoes)
 {
-    comparacoesBubble = 0;
-    int trocas = 1;
+    int numero;
+    unsigned long long prefixo;
+    const char *texto;
+    extrairChave(componente, chave, &numero, &prefixo, &texto);
 
-    printf("\n⏳ Executando BUBBLE SORT por NOME...\n");
+    int esquerda = 0;
+    int direita = entradas;
 
-    // Bubble sort com otimização (pare se não houver trocas)
-    for (int i = 0; i < totalComponentes - 1 && trocas; i++)
+    while (esquerda < direita)
     {
-        trocas = 0;
+        int meio = (esquerda + direita) / 2;
+        int numeroMeio;
+        unsigned long long prefixoMeio;
+        const char *textoMeio;
+        extrairChave(componenteDoSlot(indicesTorre[chave][meio]), chave, &numeroMeio, &prefixoMeio, &textoMeio);
 
-        for (int j = 0; j < totalComponentes - i - 1; j++)
+        if (comparacoes != NULL)
         {
-            comparacoesBubble++;
-
-            // Compara nomes
-            if (strcmp(torre[j].nome, torre[j + 1].nome) > 0)
-            {
-                trocar(&torre[j], &torre[j + 1]);
-                trocas = 1;
-            }
+            (*comparacoes)++;
         }
-    }
 
-    ordenadoPorNome = 1;
-    printf("✅ Bubble Sort concluído!\n");
+        int resultado = compararChaves(numeroMeio, prefixoMeio, textoMeio, numero, prefixo, texto,
+                                       sizeof(componente->nome));
+        if (resultado < 0 || (superior && resultado == 0))
+        {
+            esquerda = meio + 1;
+        }
+        else
+        {
+            direita = meio;
+        }
+    }
+
+    return esquerda;
 }
 
 /*
- * Função: insertionSortTipo
- * Descrição: ordena componentes por TIPO usando Insertion Sort
- * Parâmetros: nenhum
+ * Função: inserirNosIndices
+ * Descrição: registra um componente recém-adicionado nos três índices
+ * Parâmetros: slot do componente (já contado em totalComponentes - 1)
  * Retorno: nenhum
  *
- * Complexidade: O(n²)
- * Melhor caso: O(n) - já ordenado
- * Pior caso: O(n²) - ordem reversa
- *
- * Como funciona:
- * - Percorre cada elemento
- * - Insere na posição correta entre os anteriores
- * - Eficiente para poucos elementos
+ * Complexidade: O(log n) comparações + O(n) deslocamento por índice
  */
-void insertionSortTipo()
+void inserirNosIndices(int slot)
 {
-    comparacoesInsertion = 0;
+    int ativos = totalComponentes - 1; // O novo componente ainda não está nos índices
 
-    printf("\n⏳ Executando INSERTION SORT por TIPO...\n");
+    for (int chave = 0; chave < TOTAL_INDICES; chave++)
+    {
+        int *indice = indicesTorre[chave];
+        int posicao = limiteIndice((ChaveOrdenacao)chave, componenteDoSlot(slot), ativos, 1, NULL);
+
+        memmove(&indice[posicao + 1], &indice[posicao], (ativos - posicao) * sizeof(int));
+        indice[posicao] = slot;
+    }
+}
 
-    for (int i = 1; i < totalComponentes; i++)
+/*
+ * Função: removerDosIndices
+ * Descrição: retira um componente dos três índices
+ * Parâmetros: slot do componente (ainda contado em totalComponentes)
+ * Retorno: nenhum
+ *
+ * Localiza o início dos empates por busca binária e procura o slot
+ * só entre eles.
+ */
+void removerDosIndices(int slot)
+{
+    for (int chave = 0; chave < TOTAL_INDICES; chave++)
     {
-        Componente chave = torre[i];
-        int j = i - 1;
+        int *indice = indicesTorre[chave];
+        int posicao = limiteIndice((ChaveOrdenacao)chave, componenteDoSlot(slot), totalComponentes, 0, NULL);
 
-        // Move elementos maiores uma posição adiante
-        while (j >= 0 && strcmp(torre[j].tipo, chave.tipo) > 0)
+        while (posicao < totalComponentes && indice[posicao] != slot)
         {
-            comparacoesInsertion++;
-            torre[j + 1] = torre[j];
-            j--;
+            posicao++;
         }
 
-        if (j >= 0)
-            comparacoesInsertion++;
+        memmove(&indice[posicao], &indice[posicao + 1], (totalComponentes - posicao - 1) * sizeof(int));
+    }
+}
+
+/*
+ * Função: localizarPorNome
+ * Descrição: busca binária de um nome no índice de nomes
+ * Parâmetros: nome e contador de comparações (pode ser NULL)
+ * Retorno: posição do componente em torre ou -1
+ *
+ * Complexidade: O(log n), qualquer que seja a ordem atual de torre
+ */
+int localizarPorNome(const char *nome, int *comparacoes)
+{
+    Componente referencia;
+    strncpy(referencia.nome, nome, sizeof(referencia.nome) - 1);
+    referencia.nome[sizeof(referencia.nome) - 1] = 0;
+    referencia.prefixoNome = prefixoTexto(referencia.nome);
+
+    int posicao = limiteIndice(CHAVE_NOME, &referencia, totalComponentes, 0, comparacoes);
 
-        torre[j + 1] = chave;
+    if (posicao < totalComponentes)
+    {
+        Componente *componente = componenteDoSlot(indicesTorre[CHAVE_NOME][posicao]);
+        if (compararTextos(componente->prefixoNome, componente->nome,
+                           referencia.prefixoNome, referencia.nome, sizeof(referencia.nome)) == 0)
+        {
+            return slotsTorre[indicesTorre[CHAVE_NOME][posicao]].posicao;
+        }
     }
 
-    ordenadoPorTipo = 1;
-    printf("✅ Insertion Sort concluído!\n");
+    return -1;
 }
 
 /*
- * Função: selectionSortPrioridade
- * Descrição: ordena componentes por PRIORIDADE usando Selection Sort
- * Parâmetros: nenhum
+ * Função: ordemDoIndice
+ * Descrição: converte um índice secundário em posições de torre
+ * Parâmetros: chave do índice e vetor de saída (totalComponentes)
  * Retorno: nenhum
  *
- * Complexidade: O(n²) - sempre
+ * Complexidade: O(n), sem comparações
+ */
+void ordemDoIndice(ChaveOrdenacao chave, int *ordem)
+{
+    for (int i = 0; i < totalComponentes; i++)
+    {
+        ordem[i] = slotsTorre[indicesTorre[chave][i]].posicao;
+    }
+}
+
+/* ========================================
+ * FUNÇÕES AUXILIARES
+ * ======================================== */
+
+/*
+ * Função: relogioSegundos
+ * Descrição: lê um relógio monotônico de parede
+ * Parâmetros: nenhum
+ * Retorno: instante atual em segundos (origem arbitrária)
  *
- * Como funciona:
- * - Encontra o elemento máximo
- * - Coloca na posição correta
- * - Repete para o restante
- * - Ordena em ordem DECRESCENTE de prioridade
+ * clock() soma o tempo de CPU de todas as threads, então não serve
+ * para medir ordenações paralelas.
  */
-void selectionSortPrioridade()
+double relogioSegundos()
 {
-    comparacoesSelection = 0;
+#ifdef _WIN32
+    static LARGE_INTEGER frequencia;
+    LARGE_INTEGER contador;
+
+    if (frequencia.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&frequencia);
+    }
+    QueryPerformanceCounter(&contador);
 
-    printf("\n⏳ Executando SELECTION SORT por PRIORIDADE...\n");
+    return (double)contador.QuadPart / (double)frequencia.QuadPart;
+#else
+    struct timespec agora;
+
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (double)agora.tv_sec + agora.tv_nsec / 1e9;
+#endif
+}
 
-    for (int i = 0; i < totalComponentes - 1; i++)
+/*
+ * Função: compactarTorre
+ * Descrição: elimina as lápides deixadas pelas remoções
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Preserva a ordem relativa dos componentes; os índices guardam slots
+ * e não são afetados. Chamada antes das ordenações e quando
+ * as lápides passam de 1/4 das posições.
+ */
+void compactarTorre()
+{
+    if (componentesRemovidos == 0)
     {
-        int maiorIndice = i;
+        return;
+    }
 
-        // Encontra o componente com MAIOR prioridade
-        for (int j = i + 1; j < totalComponentes; j++)
+    int destino = 0;
+    for (int i = 0; i < posicoesTorre; i++)
+    {
+        if (!torre[i].removido)
         {
-            comparacoesSelection++;
-
-            if (torre[j].prioridade > torre[maiorIndice].prioridade)
+            if (destino != i)
             {
-                maiorIndice = j;
+                torre[destino] = torre[i];
+                slotsTorre[torre[destino].slot].posicao = destino;
             }
-        }
-
-        if (maiorIndice != i)
-        {
-            trocar(&torre[i], &torre[maiorIndice]);
+            destino++;
         }
     }
 
-    ordenadoPorPrioridade = 1;
-    printf("✅ Selection Sort concluído!\n");
+    posicoesTorre = destino;
+    componentesRemovidos = 0;
+}
+
+/*
+ * Função: removerPosicao
+ * Descrição: transforma em lápide o componente de uma posição
+ * Parâmetros: posição de um componente ativo
+ * Retorno: nenhum
+ *
+ * Compacta a torre quando as lápides passam de 1/4 das posições.
+ */
+void removerPosicao(int indice)
+{
+    removerDosIndices(torre[indice].slot);
+    liberarSlot(torre[indice].slot);
+    torre[indice].removido = 1;
+    componentesRemovidos++;
+    totalComponentes--;
+
+    if (componentesRemovidos * FRACAO_MAXIMA_LAPIDES > posicoesTorre)
+    {
+        compactarTorre();
+    }
 }
 
 /* ========================================
- * BUSCA BINÁRIA
+ * OPERAÇÕES BÁSICAS
  * ======================================== */
 
 /*
- * Função: buscaBinariaPorNome
- * Descrição: busca componente por nome (requer ordenação)
+ * Função: adicionarComponente
+ * Descrição: adiciona um novo componente à torre
  * Parâmetros: nenhum
  * Retorno: nenhum
- *
- * Complexidade: O(log n)
- * Precondição: dados devem estar ordenados por nome
- *
- * Como funciona:
- * - Divide o espaço de busca pela metade a cada comparação
- * - MUITO mais rápido que busca sequencial para muitos dados
  */
-void buscaBinariaPorNome()
+void adicionarComponente()
 {
     printf("\n%s\n", LINHA);
-    printf("      🔦 BUSCA BINÁRIA POR NOME 🔦\n");
+    printf("      ➕ ADICIONAR COMPONENTE À TORRE ➕\n");
     printf("%s\n", LINHA);
 
-    if (totalComponentes == 0)
+    // Reaproveita as posições das lápides antes de recusar
+    if (posicoesTorre >= MAX_COMPONENTES)
     {
-        printf("⚠️  Torre vazia!\n");
+        compactarTorre();
+    }
+
+    if (posicoesTorre >= MAX_COMPONENTES)
+    {
+        printf("❌ Erro: Torre cheia! Máximo de %d componentes.\n", MAX_COMPONENTES);
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Digite o nome do componente: ");
+    fgets(torre[posicoesTorre].nome, sizeof(torre[posicoesTorre].nome), stdin);
+    torre[posicoesTorre].nome[strcspn(torre[posicoesTorre].nome, "\n")] = 0;
+
+    char tipo[TAMANHO_TIPO];
+    printf("Digite o tipo (controle/suporte/propulsão/etc): ");
+    fgets(tipo, sizeof(tipo), stdin);
+    tipo[strcspn(tipo, "\n")] = 0;
+
+    printf("Digite a prioridade (1-10): ");
+    scanf("%d", &torre[posicoesTorre].prioridade);
+    getchar();
+
+    printf("Digite a quantidade: ");
+    scanf("%d", &torre[posicoesTorre].quantidade);
+    getchar();
+
+    if (torre[posicoesTorre].prioridade < 1 || torre[posicoesTorre].prioridade > 10)
+    {
+        printf("❌ Erro: Prioridade deve estar entre 1 e 10!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    if (torre[posicoesTorre].quantidade <= 0)
+    {
+        printf("❌ Erro: A quantidade deve ser maior que zero!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    int numeroTipo = internarTipo(tipo);
+    if (numeroTipo == -1)
+    {
+        printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
         printf("%s\n\n", LINHA);
         return;
     }
 
-    if (!ordenadoPorNome)
+    torre[posicoesTorre].tipo = (unsigned char)numeroTipo;
+    torre[posicoesTorre].removido = 0;
+    torre[posicoesTorre].prefixoNome = prefixoTexto(torre[posicoesTorre].nome);
+    Handle handle = alocarSlot(posicoesTorre);
+    torre[posicoesTorre].slot = handle.slot;
+    posicoesTorre++;
+    totalComponentes++;
+    inserirNosIndices(handle.slot);
+    printf("✅ Componente '%s' adicionado com sucesso à torre!\n", torre[posicoesTorre - 1].nome);
+    printf("🔑 Handle do componente: %d:%u\n", handle.slot, handle.geracao);
+    printf("%s\n", LINHA);
+
+    // Exibe a listagem atualizada
+    exibirComponentes(0);
+}
+
+/*
+ * Função: removerComponente
+ * Descrição: remove um componente pelo nome
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * O componente é localizado pelo índice de nomes em O(log n). A
+ * posição vira uma lápide em vez de deslocar os seguintes; a torre
+ * é compactada quando as lápides passam de 1/4 das posições.
+ */
+void removerComponente()
+{
+    printf("\n%s\n", LINHA);
+    printf("      ❌ REMOVER COMPONENTE ❌\n");
+    printf("%s\n", LINHA);
+
+    if (totalComponentes == 0)
     {
-        printf("⚠️  ATENÇÃO: Os componentes devem estar ORDENADOS POR NOME!\n");
-        printf("   Use a opção 'Ordenar por Nome (Bubble Sort)' primeiro.\n");
+        printf("⚠️  Torre vazia! Nada para remover.\n");
         printf("%s\n\n", LINHA);
         return;
     }
 
     char nome[30];
-    printf("Digite o nome do componente a buscar: ");
+    printf("Nome do componente a remover: ");
     fgets(nome, sizeof(nome), stdin);
     nome[strcspn(nome, "\n")] = 0;
 
-    int comparacoes = 0;
-    int esquerda = 0;
-    int direita = totalComponentes - 1;
-    int encontrado = -1;
+    int indice = localizarPorNome(nome, NULL);
 
-    while (esquerda <= direita)
+    if (indice != -1)
     {
-        comparacoes++;
-        int meio = (esquerda + direita) / 2;
-        int resultado = strcmp(torre[meio].nome, nome);
+        printf("✅ Componente '%s' removido!\n", nome);
 
-        if (resultado == 0)
-        {
-            encontrado = meio;
-            break;
-        }
-        else if (resultado < 0)
+        removerPosicao(indice);
+        printf("%s\n", LINHA);
+
+        exibirComponentes(0);
+    }
+    else
+    {
+        printf("❌ Componente '%s' não encontrado!\n", nome);
+        printf("%s\n\n", LINHA);
+    }
+}
+
+/* ========================================
+ * SAÍDA BUFFERIZADA E PAGINAÇÃO
+ * ========================================
+ *
+ * As linhas da tabela são formatadas em um único buffer reutilizável
+ * e enviadas ao terminal com uma escrita por página. A listagem mostra
+ * TAMANHO_PAGINA componentes por vez.
+ */
+
+#define TAMANHO_PAGINA 50
+#define TAMANHO_BUFFER_SAIDA 16384
+
+char bufferSaida[TAMANHO_BUFFER_SAIDA]; // Buffer reutilizado por todas as páginas
+size_t usoBufferSaida = 0;              // Bytes pendentes no buffer
+
+const int *ordemExibicao = NULL; // Se definida, a listagem segue esta permutação em vez de torre
+
+/*
+ * Função: descarregarBuffer
+ * Descrição: envia o conteúdo pendente do buffer ao terminal
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * O stdout é esvaziado antes para manter a ordem com os printf comuns;
+ * depois a página vai direto ao descritor, sem passar de novo pelo
+ * buffer do stdio. Escritas parciais continuam de onde pararam e
+ * interrupções por sinal (EINTR) são repetidas. Se a saída falhar (ex:
+ * terminal ou pipe fechado), o restante da página é descartado.
+ */
+void descarregarBuffer()
+{
+    if (usoBufferSaida == 0)
+    {
+        return;
+    }
+
+    fflush(stdout);
+#ifdef _WIN32
+    fwrite(bufferSaida, 1, usoBufferSaida, stdout);
+    fflush(stdout);
+#else
+    size_t enviados = 0;
+    while (enviados < usoBufferSaida)
+    {
+        ssize_t escritos = write(STDOUT_FILENO, bufferSaida + enviados, usoBufferSaida - enviados);
+        if (escritos < 0 && errno == EINTR)
         {
-            esquerda = meio + 1;
+            continue;
         }
-        else
+        if (escritos <= 0)
         {
-            direita = meio - 1;
+            break;
         }
+        enviados += (size_t)escritos;
     }
+#endif
+    usoBufferSaida = 0;
+}
 
-    if (encontrado != -1)
+/*
+ * Função: anexarBuffer
+ * Descrição: formata texto (como printf) no final do buffer de saída
+ * Parâmetros: formato e argumentos
+ * Retorno: nenhum
+ *
+ * Se o texto não couber, o buffer é descarregado antes.
+ */
+void anexarBuffer(const char *formato, ...)
+{
+    va_list argumentos;
+
+    va_start(argumentos, formato);
+    int tamanho = vsnprintf(bufferSaida + usoBufferSaida,
+                            TAMANHO_BUFFER_SAIDA - usoBufferSaida, formato, argumentos);
+    va_end(argumentos);
+
+    if (tamanho < 0)
     {
-        printf("\n✅ COMPONENTE ENCONTRADO! ⚡\n\n");
-        printf("📌 Nome: %s\n", torre[encontrado].nome);
-        printf("🏷️  Tipo: %s\n", torre[encontrado].tipo);
-        printf("⭐ Prioridade: %d\n", torre[encontrado].prioridade);
-        printf("📊 Quantidade: %d\n", torre[encontrado].quantidade);
+        return;
+    }
 
-        // Simula ativação
-        if (strcmp(torre[encontrado].nome, "chip central") == 0 ||
-            strcmp(torre[encontrado].nome, "cristal energético") == 0 ||
-            strcmp(torre[encontrado].nome, "núcleo de controle") == 0)
+    if ((size_t)tamanho >= TAMANHO_BUFFER_SAIDA - usoBufferSaida)
+    {
+        descarregarBuffer();
+
+        va_start(argumentos, formato);
+        tamanho = vsnprintf(bufferSaida, TAMANHO_BUFFER_SAIDA, formato, argumentos);
+        va_end(argumentos);
+
+        if (tamanho >= TAMANHO_BUFFER_SAIDA)
         {
-            printf("\n🚀 Este é um componente-CHAVE! Pode ativar a torre!\n");
+            tamanho = TAMANHO_BUFFER_SAIDA - 1; // texto truncado
         }
     }
-    else
+
+    usoBufferSaida += (size_t)tamanho;
+}
+
+/*
+ * Função: posicaoDoComponente
+ * Descrição: converte a ordem de um componente ativo em posição na torre
+ * Parâmetros: ordem do componente (0 = primeiro ativo)
+ * Retorno: posição em torre ou posicoesTorre se não existir
+ */
+int posicaoDoComponente(int ordem)
+{
+    if (componentesRemovidos == 0)
     {
-        printf("\n❌ Componente '%s' não encontrado!\n", nome);
+        return ordem < posicoesTorre ? ordem : posicoesTorre;
     }
 
-    printf("\n📊 Estatísticas da busca:\n");
-    printf("   Comparações realizadas: %d\n", comparacoes);
-    printf("   Complexidade: O(log n) ⚡\n");
-
-    // Cálculo teórico
-    int comparacoesTeoricas = 0;
-    int temp = totalComponentes;
-    while (temp > 1)
+    int i = 0;
+    for (; i < posicoesTorre; i++)
     {
-        temp /= 2;
-        comparacoesTeoricas++;
+        if (!torre[i].removido && ordem-- == 0)
+        {
+            break;
+        }
     }
-    printf("   Máx comparações teóricas: ~%d\n", comparacoesTeoricas);
-    printf("%s\n\n", LINHA);
+    return i;
 }
 
-/* ========================================
- * MENUS DE ORDENAÇÃO
- * ======================================== */
-
 /*
- * Função: menuOrdenacao
- * Descrição: apresenta opções de ordenação com análise de desempenho
- * Parâmetros: nenhum
+ * Função: listarPaginaComponentes
+ * Descrição: exibe uma página da tabela com uma única escrita
+ * Parâmetros: ordem do primeiro componente e máximo de componentes
  * Retorno: nenhum
  */
-void menuOrdenacao()
+void listarPaginaComponentes(int inicio, int limite)
 {
-    int opcao;
+    anexarBuffer("Componentes %d a %d de %d\n\n",
+                 inicio + 1,
+                 inicio + limite < totalComponentes ? inicio + limite : totalComponentes,
+                 totalComponentes);
 
-    while (1)
+    anexarBuffer("┌─────────┬──────────────────────────┬─────────────┬────────────┬────────────┐\n");
+    anexarBuffer("│ #       │ Nome                     │ Tipo        │ Prioridade │ Quantidade │\n");
+    anexarBuffer("├─────────┼──────────────────────────┼─────────────┼────────────┼────────────┤\n");
+
+    int numero = inicio + 1;
+    int i = (ordemExibicao != NULL) ? 0 : posicaoDoComponente(inicio);
+
+    while (limite > 0)
+    {
+        // Leitura através da permutação: torre não é reorganizada
+        if (ordemExibicao != NULL)
+        {
+            if (numero > totalComponentes)
+            {
+                break;
+            }
+            i = ordemExibicao[numero - 1];
+        }
+        else if (i >= posicoesTorre)
+        {
+            break;
+        }
+        else if (torre[i].removido)
+        {
+            i++;
+            continue;
+        }
+
+        anexarBuffer("│ %7d │ %-24s │ %-11s │ %10d │ %10d │\n",
+                     numero++,
+                     torre[i].nome,
+                     nomeDoTipo(torre[i].tipo),
+                     torre[i].prioridade,
+                     torre[i].quantidade);
+        limite--;
+        i++;
+    }
+
+    anexarBuffer("└─────────┴──────────────────────────┴─────────────┴────────────┴────────────┘\n\n");
+    descarregarBuffer();
+}
+
+/*
+ * Função: exibirComponentes
+ * Descrição: exibe os componentes em formato tabular, paginado
+ * Parâmetros: 1 para perguntar antes de cada página, 0 para só a primeira
+ * Retorno: nenhum
+ */
+void exibirComponentes(int interativo)
+{
+    printf("\n%s\n", LINHA);
+    printf("      📦 COMPONENTES DA TORRE 📦\n");
+    printf("%s\n", LINHA);
+
+    if (totalComponentes == 0)
+    {
+        printf("⚠️  Torre vazia! Adicione componentes para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("Total de componentes: %d/%d\n", totalComponentes, MAX_COMPONENTES);
+
+    for (int inicio = 0; inicio < totalComponentes; inicio += TAMANHO_PAGINA)
+    {
+        if (inicio > 0)
+        {
+            if (!interativo)
+            {
+                printf("... e mais %d componentes (use a opção 3 para ver todos)\n\n",
+                       totalComponentes - inicio);
+                break;
+            }
+
+            char resposta[16];
+            printf("[Enter] próxima página  |  [q] parar: ");
+            if (fgets(resposta, sizeof(resposta), stdin) == NULL ||
+                resposta[0] == 'q' || resposta[0] == 'Q')
+            {
+                break;
+            }
+        }
+        listarPaginaComponentes(inicio, TAMANHO_PAGINA);
+    }
+}
+
+/*
+ * Função: listarComponentes
+ * Descrição: exibe todos os componentes, página a página
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void listarComponentes()
+{
+    exibirComponentes(1);
+}
+
+/* ========================================
+ * ARENA DE RASCUNHO DAS ORDENAÇÕES
+ * ========================================
+ *
+ * Todos os buffers temporários das ordenações (cópias, elementos
+ * decorados, vetores de ordem, rascunhos do Merge Sort e do Counting
+ * Sort, tarefas da ordenação paralela) saem de um único bloco que
+ * cresce e é reaproveitado. Quem reserva abre um escopo com marcaArena
+ * e devolve tudo de uma vez com liberarArena(marca), em ordem de pilha;
+ * toda marca tem de ser devolvida, inclusive nos caminhos de erro.
+ *
+ * Se um pedido não cabe no bloco, ele é atendido por um malloc avulso,
+ * liberado junto com o seu escopo; quando o último escopo fecha, o
+ * bloco cresce até o pico observado. A partir daí, repetir as mesmas
+ * ordenações não faz nenhuma alocação no heap.
+ *
+ * Só a thread principal reserva: as threads da ordenação paralela
+ * recebem buffers já reservados.
+ */
+
+#define ALINHAMENTO_ARENA 16
+#define CAPACIDADE_INICIAL_ARENA (64 * 1024) // Cobre com folga todas as ordenações da torre
+#define ARENA_RETIDA_MAXIMA (1024 * 1024)     // Acima disto o bloco é devolvido após benchmarks
+
+ArenaOrdenacao arenaOrdenacao = {NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0};
+
+/*
+ * Função: alinharArena
+ * Descrição: arredonda um tamanho para o alinhamento da arena
+ * Parâmetros: bytes
+ * Retorno: bytes arredondados para cima
+ */
+size_t alinharArena(size_t bytes)
+{
+    return (bytes + ALINHAMENTO_ARENA - 1) & ~(size_t)(ALINHAMENTO_ARENA - 1);
+}
+
+/*
+ * Função: marcaArena
+ * Descrição: abre um escopo de reservas na arena
+ * Parâmetros: nenhum
+ * Retorno: marca a ser devolvida com liberarArena
+ */
+size_t marcaArena()
+{
+    arenaOrdenacao.escoposAbertos++;
+    return arenaOrdenacao.usado;
+}
+
+/*
+ * Função: reservarArena
+ * Descrição: reserva um buffer temporário na arena
+ * Parâmetros: bytes
+ * Retorno: ponteiro alinhado a ALINHAMENTO_ARENA, ou NULL se faltou memória
+ */
+void *reservarArena(size_t bytes)
+{
+    bytes = alinharArena(bytes > 0 ? bytes : 1);
+    arenaOrdenacao.reservas++;
+
+    // Primeiro uso (ou após devolverArena): nada aponta para o bloco ainda
+    if (arenaOrdenacao.bloco == NULL)
+    {
+        size_t capacidade = bytes > CAPACIDADE_INICIAL_ARENA ? bytes : CAPACIDADE_INICIAL_ARENA;
+
+        arenaOrdenacao.bloco = (char *)malloc(capacidade);
+        if (arenaOrdenacao.bloco != NULL)
+        {
+            arenaOrdenacao.capacidade = capacidade;
+            arenaOrdenacao.alocacoesHeap++;
+        }
+    }
+
+    if (arenaOrdenacao.usado + bytes <= arenaOrdenacao.capacidade)
+    {
+        void *buffer = arenaOrdenacao.bloco + arenaOrdenacao.usado;
+        arenaOrdenacao.usado += bytes;
+
+        if (arenaOrdenacao.usado + arenaOrdenacao.bytesAvulsos > arenaOrdenacao.pico)
+        {
+            arenaOrdenacao.pico = arenaOrdenacao.usado + arenaOrdenacao.bytesAvulsos;
+        }
+        return buffer;
+    }
+
+    // Não cabe: malloc avulso, liberado quando a arena esvaziar
+    BlocoAvulso *avulso = (BlocoAvulso *)malloc(alinharArena(sizeof(BlocoAvulso)) + bytes);
+    if (avulso == NULL)
+    {
+        return NULL;
+    }
+
+    arenaOrdenacao.alocacoesHeap++;
+    avulso->proximo = arenaOrdenacao.avulsos;
+    avulso->escopo = arenaOrdenacao.escoposAbertos;
+    avulso->bytes = bytes;
+    arenaOrdenacao.avulsos = avulso;
+    arenaOrdenacao.bytesAvulsos += bytes;
+    arenaOrdenacao.transbordou = 1;
+
+    if (arenaOrdenacao.usado + arenaOrdenacao.bytesAvulsos > arenaOrdenacao.pico)
+    {
+        arenaOrdenacao.pico = arenaOrdenacao.usado + arenaOrdenacao.bytesAvulsos;
+    }
+
+    return (char *)avulso + alinharArena(sizeof(BlocoAvulso));
+}
+
+/*
+ * Função: liberarArena
+ * Descrição: fecha o escopo e devolve o que foi reservado nele
+ * Parâmetros: marca obtida com marcaArena
+ * Retorno: nenhum
+ *
+ * Ao fechar o último escopo, troca o bloco e os avulsos por um bloco
+ * do tamanho do pico, para que a próxima rodada caiba inteira nele.
+ */
+void liberarArena(size_t marca)
+{
+    arenaOrdenacao.usado = marca;
+    arenaOrdenacao.escoposAbertos--;
+
+    // Avulsos reservados neste escopo estão no topo da pilha
+    while (arenaOrdenacao.avulsos != NULL && arenaOrdenacao.avulsos->escopo > arenaOrdenacao.escoposAbertos)
+    {
+        BlocoAvulso *avulso = arenaOrdenacao.avulsos;
+        arenaOrdenacao.avulsos = avulso->proximo;
+        arenaOrdenacao.bytesAvulsos -= avulso->bytes;
+        free(avulso);
+    }
+
+    if (arenaOrdenacao.escoposAbertos > 0 || !arenaOrdenacao.transbordou)
+    {
+        return;
+    }
+
+    arenaOrdenacao.transbordou = 0;
+    free(arenaOrdenacao.bloco);
+    arenaOrdenacao.capacidade = alinharArena(arenaOrdenacao.pico);
+    arenaOrdenacao.bloco = (char *)malloc(arenaOrdenacao.capacidade);
+
+    if (arenaOrdenacao.bloco == NULL)
+    {
+        arenaOrdenacao.capacidade = 0;
+        return;
+    }
+    arenaOrdenacao.alocacoesHeap++;
+}
+
+/*
+ * Função: devolverArena
+ * Descrição: libera o bloco se a arena estiver vazia e grande demais
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Chamada ao fim dos benchmarks, que fazem a arena crescer a dezenas
+ * de MB; a torre (até MAX_COMPONENTES) nunca passa de ARENA_RETIDA_MAXIMA.
+ */
+void devolverArena()
+{
+    if (arenaOrdenacao.escoposAbertos > 0 || arenaOrdenacao.capacidade <= ARENA_RETIDA_MAXIMA)
+    {
+        return;
+    }
+
+    free(arenaOrdenacao.bloco);
+    arenaOrdenacao.bloco = NULL;
+    arenaOrdenacao.capacidade = 0;
+    arenaOrdenacao.pico = 0;
+}
+
+/*
+ * Função: exibirEstatisticasArena
+ * Descrição: mostra o uso da arena desde uma leitura anterior
+ * Parâmetros: reservas e alocações no heap lidas antes
+ * Retorno: nenhum
+ */
+void exibirEstatisticasArena(long long reservasAntes, long long alocacoesAntes)
+{
+    printf("   Arena de rascunho: %lld reservas, %lld alocações no heap\n",
+           arenaOrdenacao.reservas - reservasAntes, arenaOrdenacao.alocacoesHeap - alocacoesAntes);
+    printf("   (bloco de %zu bytes, pico de %zu bytes, %lld alocações no total)\n",
+           arenaOrdenacao.capacidade, arenaOrdenacao.pico, arenaOrdenacao.alocacoesHeap);
+}
+
+/* ========================================
+ * MOTOR DE ORDENAÇÃO (ALGORITMO x CHAVE)
+ * ========================================
+ *
+ * Decorar-ordenar-desdecorar: a chave escolhida é extraída uma única
+ * vez para um vetor de ElementoOrdenacao; o algoritmo escolhido ordena
+ * esse vetor e, no fim, torre é reorganizada de uma vez seguindo o
+ * campo origem. Os algoritmos são genéricos (base + tamanho + função
+ * de comparação, como o qsort) e contam as próprias comparações e os
+ * bytes que movem.
+ *
+ * O modo (ModoOrdenacao) decide o que é movido: Componente inteiros,
+ * elementos decorados ou apenas índices int. Nos dois últimos o
+ * resultado é uma permutação (ordem[i] = posição em torre do i-ésimo
+ * componente) aplicada uma única vez, ou usada só para leitura.
+ */
+
+#define TAMANHO_MAXIMO_ELEMENTO sizeof(Componente)
+#define LIMITE_DOMINIO_CONTAGEM 1024 // Maior intervalo de chaves aceito pelo Counting Sort
+#define LIMIAR_INSERCAO_MERGE 16     // Trechos menores vão para o Insertion Sort no Merge Sort
+#define CORTE_SEQUENCIAL_PADRAO 8192 // Elementos mínimos por bloco no Merge Sort paralelo
+#define MAXIMO_ESCALABILIDADE 10000000
+#define EXECUCOES_AQUECIMENTO 10  // Execuções descartadas antes de medir (caches, preditor)
+#define EXECUCOES_MEDICAO 201     // Execuções medidas por algoritmo na comparação
+
+const char *NOMES_ALGORITMOS[TOTAL_ALGORITMOS] = {"Bubble Sort", "Insertion Sort", "Selection Sort",
+                                                  "Counting Sort", "Merge Sort", "Merge Sort paralelo"};
+
+const char *NOMES_CHAVES[TOTAL_CHAVES] = {"nome", "tipo", "prioridade", "quantidade",
+                                          "prioridade + nome"};
+const char *NOMES_MODOS[TOTAL_MODOS] = {"registros (Componente)", "decorado (chave + origem)",
+                                        "índices (int)"};
+
+AlgoritmoOrdenacao ultimoAlgoritmo = ALGORITMO_BUBBLE; // Algoritmo de fato usado na última ordenação
+ModoOrdenacao modoOrdenacao = MODO_INDICES;            // O que os algoritmos movem
+int threadsOrdenacao = 1;                              // Definido em main pelo número de núcleos
+int corteSequencial = CORTE_SEQUENCIAL_PADRAO;         // Mínimo de elementos por bloco paralelo
+
+// Estatísticas da última ordenação
+long long bytesMovidosOrdenacao = 0; // Dentro do algoritmo
+long long bytesMovidosAplicacao = 0; // Ao aplicar a permutação em torre
+
+// Apoio às funções de comparação (lidas, nunca alteradas, durante a ordenação)
+ChaveOrdenacao chaveRegistros = CHAVE_NOME;     // Chave usada em MODO_REGISTROS
+const ElementoOrdenacao *chavesIndexadas = NULL; // Chaves usadas em MODO_INDICES
+
+/*
+ * Função: elementoEm
+ * Descrição: endereço do i-ésimo elemento de um vetor genérico
+ * Parâmetros: início do vetor, índice e contexto
+ * Retorno: ponteiro para o elemento
+ */
+char *elementoEm(void *base, int i, const ContextoOrdenacao *contexto)
+{
+    return (char *)base + (size_t)i * contexto->tamanho;
+}
+
+/*
+ * Função: compararContando
+ * Descrição: compara dois elementos e conta a comparação
+ * Parâmetros: dois elementos e contexto
+ * Retorno: <0, 0 ou >0
+ */
+int compararContando(const void *a, const void *b, ContextoOrdenacao *contexto)
+{
+    contexto->comparacoes++;
+    return contexto->comparar(a, b);
+}
+
+/*
+ * Função: moverElemento
+ * Descrição: copia um elemento para outra posição e conta os bytes
+ * Parâmetros: destino, origem e contexto
+ * Retorno: nenhum
+ */
+void moverElemento(void *destino, const void *origem, ContextoOrdenacao *contexto)
+{
+    memcpy(destino, origem, contexto->tamanho);
+    contexto->bytesMovidos += (long long)contexto->tamanho;
+}
+
+/*
+ * Função: trocarElementos
+ * Descrição: troca o conteúdo de dois elementos
+ * Parâmetros: dois elementos e contexto
+ * Retorno: nenhum
+ */
+void trocarElementos(void *a, void *b, ContextoOrdenacao *contexto)
+{
+    unsigned char temp[TAMANHO_MAXIMO_ELEMENTO];
+
+    moverElemento(temp, a, contexto);
+    moverElemento(a, b, contexto);
+    moverElemento(b, temp, contexto);
+}
+
+/*
+ * Função: extrairChave
+ * Descrição: lê a chave de um componente
+ * Parâmetros: componente, chave, onde guardar a parte numérica, o
+ *             prefixo e a parte textual
+ * Retorno: nenhum
+ *
+ * Chaves decrescentes (prioridade) são devolvidas com o sinal trocado,
+ * para que todas as comparações sejam crescentes.
+ */
+void extrairChave(const Componente *componente, ChaveOrdenacao chave, int *numero,
+                  unsigned long long *prefixo, const char **texto)
+{
+    *numero = 0;
+    *prefixo = 0;
+    *texto = "";
+
+    switch (chave)
+    {
+    case CHAVE_NOME:
+        *prefixo = componente->prefixoNome;
+        *texto = componente->nome;
+        break;
+
+    case CHAVE_TIPO:
+        *numero = ordemDoTipo(componente->tipo);
+        break;
+
+    case CHAVE_PRIORIDADE:
+        *numero = -componente->prioridade;
+        break;
+
+    case CHAVE_QUANTIDADE:
+        *numero = componente->quantidade;
+        break;
+
+    default:
+        *numero = -componente->prioridade;
+        *prefixo = componente->prefixoNome;
+        *texto = componente->nome;
+        break;
+    }
+}
+
+/*
+ * Função: compararChaves
+ * Descrição: ordem entre duas chaves (número, depois texto)
+ * Parâmetros: número, prefixo e texto de cada lado e largura dos textos
+ * Retorno: <0, 0 ou >0
+ */
+int compararChaves(int numeroA, unsigned long long prefixoA, const char *textoA,
+                   int numeroB, unsigned long long prefixoB, const char *textoB, size_t largura)
+{
+    if (numeroA != numeroB)
+    {
+        return numeroA < numeroB ? -1 : 1;
+    }
+    return compararTextos(prefixoA, textoA, prefixoB, textoB, largura);
+}
+
+/*
+ * Função: compararElementos
+ * Descrição: compara duas chaves extraídas (número, depois texto)
+ * Parâmetros: dois ElementoOrdenacao
+ * Retorno: <0, 0 ou >0
+ */
+int compararElementos(const void *a, const void *b)
+{
+    const ElementoOrdenacao *x = (const ElementoOrdenacao *)a;
+    const ElementoOrdenacao *y = (const ElementoOrdenacao *)b;
+
+    return compararChaves(x->numero, x->prefixo, x->texto, y->numero, y->prefixo, y->texto, sizeof(x->texto));
+}
+
+/*
+ * Função: compararRegistros
+ * Descrição: compara dois Componente pela chave chaveRegistros
+ * Parâmetros: dois Componente
+ * Retorno: <0, 0 ou >0
+ *
+ * A chave é relida a cada comparação (não há decoração neste modo).
+ */
+int compararRegistros(const void *a, const void *b)
+{
+    int numeroA, numeroB;
+    unsigned long long prefixoA, prefixoB;
+    const char *textoA, *textoB;
+
+    extrairChave((const Componente *)a, chaveRegistros, &numeroA, &prefixoA, &textoA);
+    extrairChave((const Componente *)b, chaveRegistros, &numeroB, &prefixoB, &textoB);
+
+    return compararChaves(numeroA, prefixoA, textoA, numeroB, prefixoB, textoB,
+                          sizeof(((const Componente *)a)->nome));
+}
+
+/*
+ * Função: compararIndices
+ * Descrição: compara dois índices pelas chaves em chavesIndexadas
+ * Parâmetros: dois int
+ * Retorno: <0, 0 ou >0
+ */
+int compararIndices(const void *a, const void *b)
+{
+    return compararElementos(&chavesIndexadas[*(const int *)a], &chavesIndexadas[*(const int *)b]);
+}
+
+/*
+ * Função: numeroDoElemento
+ * Descrição: chave inteira de um ElementoOrdenacao
+ * Parâmetros: elemento
+ * Retorno: campo numero
+ */
+int numeroDoElemento(const void *elemento)
+{
+    return ((const ElementoOrdenacao *)elemento)->numero;
+}
+
+/*
+ * Função: numeroDoRegistro
+ * Descrição: chave inteira de um Componente (chaveRegistros)
+ * Parâmetros: componente
+ * Retorno: parte numérica da chave
+ */
+int numeroDoRegistro(const void *componente)
+{
+    int numero;
+    unsigned long long prefixo;
+    const char *texto;
+
+    extrairChave((const Componente *)componente, chaveRegistros, &numero, &prefixo, &texto);
+    return numero;
+}
+
+/*
+ * Função: numeroDoIndice
+ * Descrição: chave inteira do componente apontado por um índice
+ * Parâmetros: int
+ * Retorno: parte numérica da chave
+ */
+int numeroDoIndice(const void *indice)
+{
+    return chavesIndexadas[*(const int *)indice].numero;
+}
+
+/*
+ * Função: contextoParaModo
+ * Descrição: monta o contexto para ordenar no modo e chave pedidos
+ * Parâmetros: modo e chave
+ * Retorno: contexto pronto
+ *
+ * Só chaves puramente numéricas (tipo, prioridade, quantidade) expõem
+ * a chave inteira ao Counting Sort.
+ */
+ContextoOrdenacao contextoParaModo(ModoOrdenacao modo, ChaveOrdenacao chave)
+{
+    int numerica = (chave == CHAVE_TIPO || chave == CHAVE_PRIORIDADE || chave == CHAVE_QUANTIDADE);
+    ContextoOrdenacao contexto = {sizeof(ElementoOrdenacao), compararElementos,
+                                  numerica ? numeroDoElemento : NULL, 0, 0};
+
+    if (modo == MODO_REGISTROS)
+    {
+        contexto.tamanho = sizeof(Componente);
+        contexto.comparar = compararRegistros;
+        contexto.chaveInteira = numerica ? numeroDoRegistro : NULL;
+    }
+    else if (modo == MODO_INDICES)
+    {
+        contexto.tamanho = sizeof(int);
+        contexto.comparar = compararIndices;
+        contexto.chaveInteira = numerica ? numeroDoIndice : NULL;
+    }
+
+    return contexto;
+}
+
+/*
+ * Função: dominioChaves
+ * Descrição: calcula o intervalo das chaves inteiras de um vetor
+ * Parâmetros: vetor, quantidade, contexto e onde guardar o mínimo
+ * Retorno: tamanho do domínio (máximo - mínimo + 1), ou 0 se não há
+ *          chave inteira ou o domínio passa de LIMITE_DOMINIO_CONTAGEM
+ */
+int dominioChaves(void *base, int n, const ContextoOrdenacao *contexto, int *minimo)
+{
+    if (contexto->chaveInteira == NULL || n == 0)
+    {
+        return 0;
+    }
+
+    int menor = contexto->chaveInteira(elementoEm(base, 0, contexto));
+    int maior = menor;
+
+    for (int i = 1; i < n; i++)
+    {
+        int chave = contexto->chaveInteira(elementoEm(base, i, contexto));
+        if (chave < menor)
+        {
+            menor = chave;
+        }
+        if (chave > maior)
+        {
+            maior = chave;
+        }
+    }
+
+    long long dominio = (long long)maior - menor + 1;
+    if (dominio > LIMITE_DOMINIO_CONTAGEM)
+    {
+        return 0;
+    }
+
+    *minimo = menor;
+    return (int)dominio;
+}
+
+/*
+ * Função: countingSortGenerico
+ * Descrição: Counting Sort estável para chaves inteiras
+ * Parâmetros: vetor, quantidade, contexto, menor chave e domínio
+ * Retorno: 1 se ordenou, 0 se faltou memória
+ *
+ * Complexidade: O(n + k), k = domínio; nenhuma comparação.
+ * Como funciona:
+ * - Conta quantos elementos há de cada chave
+ * - Soma acumulada: onde começa cada chave na saída
+ * - Copia os elementos na ordem original para as suas faixas,
+ *   o que mantém a ordenação ESTÁVEL
+ */
+int countingSortGenerico(void *base, int n, ContextoOrdenacao *contexto, int minimo, int dominio)
+{
+    size_t marca = marcaArena();
+    int *inicioFaixa = (int *)reservarArena((dominio + 1) * sizeof(int));
+    char *saida = (char *)reservarArena((size_t)n * contexto->tamanho);
+
+    if (inicioFaixa == NULL || saida == NULL)
+    {
+        liberarArena(marca);
+        return 0;
+    }
+    memset(inicioFaixa, 0, (dominio + 1) * sizeof(int));
+
+    for (int i = 0; i < n; i++)
+    {
+        inicioFaixa[contexto->chaveInteira(elementoEm(base, i, contexto)) - minimo + 1]++;
+    }
+
+    for (int k = 1; k <= dominio; k++)
+    {
+        inicioFaixa[k] += inicioFaixa[k - 1];
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        char *elemento = elementoEm(base, i, contexto);
+        int destino = inicioFaixa[contexto->chaveInteira(elemento) - minimo]++;
+        moverElemento(saida + (size_t)destino * contexto->tamanho, elemento, contexto);
+    }
+
+    memcpy(base, saida, (size_t)n * contexto->tamanho);
+    contexto->bytesMovidos += (long long)n * (long long)contexto->tamanho;
+    liberarArena(marca);
+    return 1;
+}
+
+/*
+ * Função: bubbleSortGenerico
+ * Descrição: Bubble Sort com parada antecipada
+ * Parâmetros: vetor, quantidade e contexto
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²); O(n) se já ordenado. Estável.
+ */
+void bubbleSortGenerico(void *base, int n, ContextoOrdenacao *contexto)
+{
+    int trocas = 1;
+
+    for (int i = 0; i < n - 1 && trocas; i++)
+    {
+        trocas = 0;
+
+        for (int j = 0; j < n - i - 1; j++)
+        {
+            char *atual = elementoEm(base, j, contexto);
+            char *proximo = elementoEm(base, j + 1, contexto);
+
+            if (compararContando(atual, proximo, contexto) > 0)
+            {
+                trocarElementos(atual, proximo, contexto);
+                trocas = 1;
+            }
+        }
+    }
+}
+
+/*
+ * Função: insertionSortGenerico
+ * Descrição: Insertion Sort
+ * Parâmetros: vetor, quantidade e contexto
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²); O(n) se já ordenado. Estável.
+ */
+void insertionSortGenerico(void *base, int n, ContextoOrdenacao *contexto)
+{
+    unsigned char chave[TAMANHO_MAXIMO_ELEMENTO];
+
+    for (int i = 1; i < n; i++)
+    {
+        if (compararContando(elementoEm(base, i - 1, contexto), elementoEm(base, i, contexto), contexto) <= 0)
+        {
+            continue; // Já está no lugar: nada a mover
+        }
+
+        moverElemento(chave, elementoEm(base, i, contexto), contexto);
+        moverElemento(elementoEm(base, i, contexto), elementoEm(base, i - 1, contexto), contexto);
+        int j = i - 2;
+
+        // Move elementos maiores uma posição adiante
+        while (j >= 0 && compararContando(elementoEm(base, j, contexto), chave, contexto) > 0)
+        {
+            moverElemento(elementoEm(base, j + 1, contexto), elementoEm(base, j, contexto), contexto);
+            j--;
+        }
+
+        moverElemento(elementoEm(base, j + 1, contexto), chave, contexto);
+    }
+}
+
+/*
+ * Função: selectionSortGenerico
+ * Descrição: Selection Sort
+ * Parâmetros: vetor, quantidade e contexto
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²) - sempre. Não é estável.
+ */
+void selectionSortGenerico(void *base, int n, ContextoOrdenacao *contexto)
+{
+    for (int i = 0; i < n - 1; i++)
+    {
+        int menorIndice = i;
+
+        for (int j = i + 1; j < n; j++)
+        {
+            if (compararContando(elementoEm(base, j, contexto),
+                                 elementoEm(base, menorIndice, contexto), contexto) < 0)
+            {
+                menorIndice = j;
+            }
+        }
+
+        if (menorIndice != i)
+        {
+            trocarElementos(elementoEm(base, i, contexto), elementoEm(base, menorIndice, contexto), contexto);
+        }
+    }
+}
+
+/*
+ * Função: intercalarIntervalos
+ * Descrição: intercala dois intervalos ordenados de origem em destino
+ * Parâmetros: origem, intervalos [inicioA, fimA) e [inicioB, fimB),
+ *             destino, posição inicial no destino e contexto
+ * Retorno: nenhum
+ *
+ * Nos empates vem primeiro o elemento de A, o que mantém a estabilidade.
+ */
+void intercalarIntervalos(const void *origem, int inicioA, int fimA, int inicioB, int fimB,
+                          void *destino, int posicaoDestino, ContextoOrdenacao *contexto)
+{
+    void *fonte = (void *)origem;
+    int k = posicaoDestino;
+
+    while (inicioA < fimA && inicioB < fimB)
+    {
+        if (compararContando(elementoEm(fonte, inicioB, contexto), elementoEm(fonte, inicioA, contexto), contexto) < 0)
+        {
+            moverElemento(elementoEm(destino, k++, contexto), elementoEm(fonte, inicioB++, contexto), contexto);
+        }
+        else
+        {
+            moverElemento(elementoEm(destino, k++, contexto), elementoEm(fonte, inicioA++, contexto), contexto);
+        }
+    }
+
+    while (inicioA < fimA)
+    {
+        moverElemento(elementoEm(destino, k++, contexto), elementoEm(fonte, inicioA++, contexto), contexto);
+    }
+
+    while (inicioB < fimB)
+    {
+        moverElemento(elementoEm(destino, k++, contexto), elementoEm(fonte, inicioB++, contexto), contexto);
+    }
+}
+
+/*
+ * Função: mergeSortIntervalo
+ * Descrição: Merge Sort recursivo de base[inicio, fim)
+ * Parâmetros: vetor, rascunho (mesmo tamanho), intervalo e contexto
+ * Retorno: nenhum
+ *
+ * Trechos pequenos vão para o Insertion Sort; metades que já estão em
+ * ordem não são intercaladas (O(n) para entrada ordenada).
+ */
+void mergeSortIntervalo(void *base, void *auxiliar, int inicio, int fim, ContextoOrdenacao *contexto)
+{
+    if (fim - inicio <= LIMIAR_INSERCAO_MERGE)
+    {
+        insertionSortGenerico(elementoEm(base, inicio, contexto), fim - inicio, contexto);
+        return;
+    }
+
+    int meio = inicio + (fim - inicio) / 2;
+    mergeSortIntervalo(base, auxiliar, inicio, meio, contexto);
+    mergeSortIntervalo(base, auxiliar, meio, fim, contexto);
+
+    if (compararContando(elementoEm(base, meio - 1, contexto), elementoEm(base, meio, contexto), contexto) <= 0)
+    {
+        return;
+    }
+
+    intercalarIntervalos(base, inicio, meio, meio, fim, auxiliar, inicio, contexto);
+
+    size_t bytes = (size_t)(fim - inicio) * contexto->tamanho;
+    memcpy(elementoEm(base, inicio, contexto), elementoEm(auxiliar, inicio, contexto), bytes);
+    contexto->bytesMovidos += (long long)bytes;
+}
+
+/*
+ * Função: mergeSortGenerico
+ * Descrição: Merge Sort
+ * Parâmetros: vetor, quantidade e contexto
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n log n) - sempre. Estável. Usa um rascunho de n
+ * elementos; sem memória, cai no Insertion Sort.
+ */
+void mergeSortGenerico(void *base, int n, ContextoOrdenacao *contexto)
+{
+    size_t marca = marcaArena();
+    void *auxiliar = reservarArena((size_t)n * contexto->tamanho);
+
+    if (auxiliar == NULL)
+    {
+        liberarArena(marca);
+        insertionSortGenerico(base, n, contexto);
+        return;
+    }
+
+    mergeSortIntervalo(base, auxiliar, 0, n, contexto);
+    liberarArena(marca);
+}
+
+/*
+ * Função: executarAlgoritmo
+ * Descrição: ordena um vetor genérico com o algoritmo escolhido
+ * Parâmetros: algoritmo, vetor, quantidade e contexto
+ * Retorno: nenhum (comparações ficam em contexto->comparacoes)
+ *
+ * ALGORITMO_AUTOMATICO usa Counting Sort quando a chave é inteira e o
+ * domínio é pequeno (ex: prioridade 1..10) e Insertion Sort nos demais
+ * casos. Counting Sort pedido para uma chave que não o admite também
+ * cai no Insertion Sort, que é estável como ele. O algoritmo de fato
+ * usado fica em ultimoAlgoritmo.
+ */
+void executarAlgoritmo(AlgoritmoOrdenacao algoritmo, void *base, int n, ContextoOrdenacao *contexto)
+{
+    if (algoritmo == ALGORITMO_AUTOMATICO || algoritmo == ALGORITMO_CONTAGEM)
+    {
+        int minimo = 0;
+        int dominio = dominioChaves(base, n, contexto, &minimo);
+
+        algoritmo = ALGORITMO_INSERTION;
+        if (dominio > 0 && countingSortGenerico(base, n, contexto, minimo, dominio))
+        {
+            ultimoAlgoritmo = ALGORITMO_CONTAGEM;
+            return;
+        }
+    }
+
+    ultimoAlgoritmo = algoritmo;
+
+    switch (algoritmo)
+    {
+    case ALGORITMO_BUBBLE:
+        bubbleSortGenerico(base, n, contexto);
+        break;
+
+    case ALGORITMO_INSERTION:
+        insertionSortGenerico(base, n, contexto);
+        break;
+
+    case ALGORITMO_MERGE:
+        mergeSortGenerico(base, n, contexto);
+        break;
+
+    case ALGORITMO_PARALELO:
+        mergeSortParalelo(base, n, contexto, threadsOrdenacao);
+        break;
+
+    default:
+        selectionSortGenerico(base, n, contexto);
+        break;
+    }
+}
+
+/*
+ * Função: decorarComponentes
+ * Descrição: extrai a chave de cada componente ativo (decorar)
+ * Parâmetros: chave e vetor destino (totalComponentes posições)
+ * Retorno: quantidade de elementos gerados
+ */
+int decorarComponentes(ChaveOrdenacao chave, ElementoOrdenacao *elementos)
+{
+    int n = 0;
+
+    for (int i = 0; i < posicoesTorre; i++)
+    {
+        if (torre[i].removido)
+        {
+            continue;
+        }
+
+        ElementoOrdenacao *elemento = &elementos[n++];
+        const char *texto;
+
+        extrairChave(&torre[i], chave, &elemento->numero, &elemento->prefixo, &texto);
+        strcpy(elemento->texto, texto);
+        elemento->origem = i;
+    }
+
+    return n;
+}
+
+/*
+ * Função: calcularOrdem
+ * Descrição: ordena sem tocar em torre e devolve a permutação
+ * Parâmetros: modo, algoritmo, chave, vetor ordem (totalComponentes
+ *             posições) e contexto que recebe as estatísticas
+ * Retorno: quantidade de componentes, ou -1 se faltou memória
+ *
+ * Ao final, ordem[i] é a posição em torre do i-ésimo componente na
+ * ordem pedida. MODO_REGISTROS ordena uma cópia dos componentes.
+ */
+int calcularOrdem(ModoOrdenacao modo, AlgoritmoOrdenacao algoritmo, ChaveOrdenacao chave,
+                  int *ordem, ContextoOrdenacao *contexto)
+{
+    int n = 0;
+    size_t marca = marcaArena();
+
+    *contexto = contextoParaModo(modo, chave);
+
+    if (modo == MODO_REGISTROS)
+    {
+        Componente *copia = (Componente *)reservarArena(totalComponentes * sizeof(Componente));
+        if (copia == NULL)
+        {
+            liberarArena(marca);
+            return -1;
+        }
+
+        for (int i = 0; i < posicoesTorre; i++)
+        {
+            if (!torre[i].removido)
+            {
+                copia[n++] = torre[i];
+            }
+        }
+
+        chaveRegistros = chave;
+        executarAlgoritmo(algoritmo, copia, n, contexto);
+
+        // O slot de cada componente sabe onde ele está em torre
+        for (int i = 0; i < n; i++)
+        {
+            ordem[i] = slotsTorre[copia[i].slot].posicao;
+        }
+
+        liberarArena(marca);
+        return n;
+    }
+
+    ElementoOrdenacao *elementos = (ElementoOrdenacao *)reservarArena(totalComponentes * sizeof(ElementoOrdenacao));
+    if (elementos == NULL)
+    {
+        liberarArena(marca);
+        return -1;
+    }
+
+    n = decorarComponentes(chave, elementos);
+
+    if (modo == MODO_DECORADO)
+    {
+        executarAlgoritmo(algoritmo, elementos, n, contexto);
+
+        for (int i = 0; i < n; i++)
+        {
+            ordem[i] = elementos[i].origem;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+        {
+            ordem[i] = i;
+        }
+
+        chavesIndexadas = elementos;
+        executarAlgoritmo(algoritmo, ordem, n, contexto);
+        chavesIndexadas = NULL;
+
+        for (int i = 0; i < n; i++)
+        {
+            ordem[i] = elementos[ordem[i]].origem;
+        }
+    }
+
+    liberarArena(marca);
+    return n;
+}
+
+/*
+ * Função: aplicarPermutacao
+ * Descrição: reorganiza torre segundo a permutação, no próprio lugar
+ * Parâmetros: ordem (destruída no processo) e quantidade
+ * Retorno: bytes de Componente movidos
+ *
+ * Precondição: torre compactada (ordem é uma permutação de 0..n-1)
+ * Segue os ciclos da permutação: cada componente fora do lugar é
+ * copiado uma única vez, mais um para o temporário de cada ciclo.
+ */
+long long aplicarPermutacao(int *ordem, int n)
+{
+    long long bytes = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (ordem[i] == i)
+        {
+            continue;
+        }
+
+        Componente temp = torre[i];
+        int destino = i;
+
+        while (ordem[destino] != i)
+        {
+            int origem = ordem[destino];
+
+            torre[destino] = torre[origem];
+            ordem[destino] = destino;
+            destino = origem;
+            bytes += sizeof(Componente);
+        }
+
+        torre[destino] = temp;
+        ordem[destino] = destino;
+        bytes += 2 * sizeof(Componente);
+    }
+
+    return bytes;
+}
+
+/*
+ * Função: ordenarTorre
+ * Descrição: ordena torre com qualquer algoritmo e qualquer chave
+ * Parâmetros: algoritmo e chave
+ * Retorno: comparações realizadas, ou -1 se faltou memória
+ *
+ * Usa modoOrdenacao e registra os bytes movidos da ordenação e da
+ * aplicação da permutação.
+ */
+long long ordenarTorre(AlgoritmoOrdenacao algoritmo, ChaveOrdenacao chave)
+{
+    compactarTorre();
+
+    ContextoOrdenacao contexto = contextoParaModo(modoOrdenacao, chave);
+    bytesMovidosAplicacao = 0;
+
+    if (modoOrdenacao == MODO_REGISTROS)
+    {
+        // Ordena torre diretamente, movendo Componente inteiros
+        chaveRegistros = chave;
+        executarAlgoritmo(algoritmo, torre, totalComponentes, &contexto);
+    }
+    else
+    {
+        size_t marca = marcaArena();
+        int *ordem = (int *)reservarArena(totalComponentes * sizeof(int));
+        if (ordem == NULL)
+        {
+            liberarArena(marca);
+            return -1;
+        }
+
+        int n = calcularOrdem(modoOrdenacao, algoritmo, chave, ordem, &contexto);
+        if (n < 0)
+        {
+            liberarArena(marca);
+            return -1;
+        }
+
+        bytesMovidosAplicacao = aplicarPermutacao(ordem, n);
+        liberarArena(marca);
+    }
+
+    atualizarSlots();
+    bytesMovidosOrdenacao = contexto.bytesMovidos;
+
+    return contexto.comparacoes;
+}
+
+/*
+ * Função: compararTempos
+ * Descrição: ordem crescente de tempos (para qsort)
+ * Parâmetros: dois double
+ * Retorno: <0, 0 ou >0
+ */
+int compararTempos(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * Função: calcularEstatisticas
+ * Descrição: resume uma série de tempos
+ * Parâmetros: tempos (são ordenados), quantidade e destino
+ * Retorno: nenhum
+ *
+ * Percentis pelo método do posto mais próximo: o p-ésimo percentil é
+ * o menor tempo que cobre p% das execuções.
+ */
+void calcularEstatisticas(double *tempos, int n, EstatisticasTempo *estatisticas)
+{
+    qsort(tempos, n, sizeof(double), compararTempos);
+
+    double soma = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        soma += tempos[i];
+    }
+
+    double media = soma / n;
+    double somaQuadrados = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        somaQuadrados += (tempos[i] - media) * (tempos[i] - media);
+    }
+
+    estatisticas->execucoes = n;
+    estatisticas->minimo = tempos[0];
+    estatisticas->mediana = (n % 2) ? tempos[n / 2] : (tempos[n / 2 - 1] + tempos[n / 2]) / 2.0;
+    estatisticas->p90 = tempos[(int)ceil(0.90 * n) - 1];
+    estatisticas->p99 = tempos[(int)ceil(0.99 * n) - 1];
+    estatisticas->media = media;
+    estatisticas->desvio = (n > 1) ? sqrt(somaQuadrados / (n - 1)) : 0.0;
+}
+
+/*
+ * Função: medirAlgoritmo
+ * Descrição: ordena várias vezes no modo atual sem alterar torre
+ * Parâmetros: algoritmo, chave e onde guardar as estatísticas de tempo
+ * Retorno: comparações realizadas, ou -1 se faltou memória
+ *
+ * Cada execução decora (ou copia) de novo a partir de torre, então
+ * todas partem da mesma entrada. As EXECUCOES_AQUECIMENTO primeiras
+ * são descartadas. Os bytes movidos ficam em bytesMovidosOrdenacao.
+ */
+long long medirAlgoritmo(AlgoritmoOrdenacao algoritmo, ChaveOrdenacao chave, EstatisticasTempo *estatisticas)
+{
+    size_t marca = marcaArena();
+    int *ordem = (int *)reservarArena(totalComponentes * sizeof(int));
+    double *tempos = (double *)reservarArena(EXECUCOES_MEDICAO * sizeof(double));
+
+    if (ordem == NULL || tempos == NULL)
+    {
+        liberarArena(marca);
+        return -1;
+    }
+
+    ContextoOrdenacao contexto;
+    int n = 0;
+
+    for (int i = 0; i < EXECUCOES_AQUECIMENTO && n >= 0; i++)
+    {
+        n = calcularOrdem(modoOrdenacao, algoritmo, chave, ordem, &contexto);
+    }
+
+    for (int i = 0; i < EXECUCOES_MEDICAO && n >= 0; i++)
+    {
+        double inicio = relogioSegundos();
+        n = calcularOrdem(modoOrdenacao, algoritmo, chave, ordem, &contexto);
+        tempos[i] = relogioSegundos() - inicio;
+    }
+
+    if (n >= 0)
+    {
+        calcularEstatisticas(tempos, EXECUCOES_MEDICAO, estatisticas);
+    }
+
+    liberarArena(marca);
+    bytesMovidosOrdenacao = contexto.bytesMovidos;
+    return n < 0 ? -1 : contexto.comparacoes;
+}
+
+/* ========================================
+ * ORDENAÇÃO PARALELA (POOL DE THREADS)
+ * ========================================
+ *
+ * Merge Sort paralelo: o vetor é dividido em blocos, cada thread ordena
+ * um bloco e depois os blocos são intercalados aos pares, em rodadas.
+ * Cada intercalação é fatiada entre as threads: a fatia f começa no
+ * elemento A[f * |A| / fatias] e no primeiro elemento de B que não é
+ * menor que ele (busca binária), então as fatias são independentes e
+ * o resultado é estável. As rodadas alternam entre o vetor e o
+ * rascunho, sem cópia de volta a cada rodada.
+ *
+ * As funções de comparação só leem os dados, e cada tarefa conta suas
+ * comparações e bytes na própria cópia do contexto; os totais são
+ * somados no fim, então não há contador compartilhado entre threads.
+ */
+
+/*
+ * Função: resolucaoRelogio
+ * Descrição: menor intervalo que relogioSegundos distingue
+ * Parâmetros: nenhum
+ * Retorno: resolução em segundos
+ */
+double resolucaoRelogio()
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequencia;
+    QueryPerformanceFrequency(&frequencia);
+    return 1.0 / (double)frequencia.QuadPart;
+#else
+    struct timespec resolucao;
+    clock_getres(CLOCK_MONOTONIC, &resolucao);
+    return (double)resolucao.tv_sec + resolucao.tv_nsec / 1e9;
+#endif
+}
+
+/*
+ * Função: contarNucleos
+ * Descrição: número de processadores disponíveis
+ * Parâmetros: nenhum
+ * Retorno: núcleos (entre 1 e MAXIMO_THREADS)
+ */
+int contarNucleos()
+{
+#ifdef _WIN32
+    SYSTEM_INFO informacoes;
+    GetSystemInfo(&informacoes);
+    long nucleos = (long)informacoes.dwNumberOfProcessors;
+#else
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (nucleos < 1)
+    {
+        return 1;
+    }
+    return nucleos > MAXIMO_THREADS ? MAXIMO_THREADS : (int)nucleos;
+}
+
+/*
+ * Função: executarTarefa
+ * Descrição: ordena um bloco ou intercala uma fatia
+ * Parâmetros: tarefa
+ * Retorno: nenhum
+ */
+void executarTarefa(TarefaOrdenacao *tarefa)
+{
+    if (tarefa->intercalar)
+    {
+        intercalarIntervalos(tarefa->origem, tarefa->inicioA, tarefa->fimA, tarefa->inicioB, tarefa->fimB,
+                             tarefa->destino, tarefa->posicaoDestino, &tarefa->contexto);
+    }
+    else
+    {
+        mergeSortIntervalo(tarefa->destino, tarefa->auxiliar, tarefa->inicioA, tarefa->fimA, &tarefa->contexto);
+    }
+}
+
+/*
+ * Função: trabalhadorPool
+ * Descrição: laço de cada thread do pool
+ * Parâmetros: pool
+ * Retorno: NULL
+ *
+ * Pega a próxima tarefa da rodada sob a trava e a executa fora dela.
+ */
+void *trabalhadorPool(void *argumento)
+{
+    PoolOrdenacao *pool = (PoolOrdenacao *)argumento;
+
+    pthread_mutex_lock(&pool->trava);
+    while (1)
+    {
+        while (!pool->encerrar && pool->proximaTarefa >= pool->totalTarefas)
+        {
+            pthread_cond_wait(&pool->haTarefa, &pool->trava);
+        }
+
+        if (pool->encerrar)
+        {
+            break;
+        }
+
+        TarefaOrdenacao *tarefa = &pool->fila[pool->proximaTarefa++];
+
+        pthread_mutex_unlock(&pool->trava);
+        executarTarefa(tarefa);
+        pthread_mutex_lock(&pool->trava);
+
+        if (--pool->pendentes == 0)
+        {
+            pthread_cond_signal(&pool->rodadaConcluida);
+        }
+    }
+    pthread_mutex_unlock(&pool->trava);
+
+    return NULL;
+}
+
+/*
+ * Função: iniciarPool
+ * Descrição: prepara um pool ainda sem threads
+ * Parâmetros: pool
+ * Retorno: nenhum
+ */
+void iniciarPool(PoolOrdenacao *pool)
+{
+    pthread_mutex_init(&pool->trava, NULL);
+    pthread_cond_init(&pool->haTarefa, NULL);
+    pthread_cond_init(&pool->rodadaConcluida, NULL);
+    pool->fila = NULL;
+    pool->proximaTarefa = 0;
+    pool->totalTarefas = 0;
+    pool->pendentes = 0;
+    pool->encerrar = 0;
+    pool->totalThreads = 0;
+}
+
+/*
+ * Função: ampliarPool
+ * Descrição: cria threads até o pool ter pelo menos o número pedido
+ * Parâmetros: pool (sem rodada em andamento) e número de threads
+ * Retorno: threads no pool (0 se nenhuma)
+ *
+ * Threads a mais não atrapalham: cada rodada tem no máximo tantas
+ * tarefas quanto as threads pedidas na ordenação, e as demais ficam
+ * esperando em haTarefa.
+ */
+int ampliarPool(PoolOrdenacao *pool, int threads)
+{
+    if (threads > MAXIMO_THREADS)
+    {
+        threads = MAXIMO_THREADS;
+    }
+
+    while (pool->totalThreads < threads &&
+           pthread_create(&pool->threads[pool->totalThreads], NULL, trabalhadorPool, pool) == 0)
+    {
+        pool->totalThreads++;
+    }
+
+    return pool->totalThreads;
+}
+
+/*
+ * Função: executarRodada
+ * Descrição: entrega um lote de tarefas ao pool e espera todas
+ * Parâmetros: pool, tarefas e quantidade
+ * Retorno: nenhum
+ */
+void executarRodada(PoolOrdenacao *pool, TarefaOrdenacao *tarefas, int quantidade)
+{
+    pthread_mutex_lock(&pool->trava);
+    pool->fila = tarefas;
+    pool->proximaTarefa = 0;
+    pool->totalTarefas = quantidade;
+    pool->pendentes = quantidade;
+    pthread_cond_broadcast(&pool->haTarefa);
+
+    while (pool->pendentes > 0)
+    {
+        pthread_cond_wait(&pool->rodadaConcluida, &pool->trava);
+    }
+
+    pool->totalTarefas = 0;
+    pthread_mutex_unlock(&pool->trava);
+}
+
+/*
+ * Função: encerrarPool
+ * Descrição: termina as threads e libera os recursos do pool
+ * Parâmetros: pool
+ * Retorno: nenhum
+ */
+void encerrarPool(PoolOrdenacao *pool)
+{
+    pthread_mutex_lock(&pool->trava);
+    pool->encerrar = 1;
+    pthread_cond_broadcast(&pool->haTarefa);
+    pthread_mutex_unlock(&pool->trava);
+
+    for (int i = 0; i < pool->totalThreads; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->rodadaConcluida);
+    pthread_cond_destroy(&pool->haTarefa);
+    pthread_mutex_destroy(&pool->trava);
+}
+
+PoolOrdenacao poolOrdenacao; // Pool único, criado na primeira ordenação paralela
+int poolIniciado = 0;
+
+/*
+ * Função: encerrarPoolOrdenacao
+ * Descrição: termina o pool compartilhado (registrada com atexit)
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void encerrarPoolOrdenacao()
+{
+    if (poolIniciado)
+    {
+        encerrarPool(&poolOrdenacao);
+        poolIniciado = 0;
+    }
+}
+
+/*
+ * Função: obterPool
+ * Descrição: devolve o pool compartilhado com pelo menos o número de
+ *            threads pedido, criando-o na primeira chamada
+ * Parâmetros: número de threads
+ * Retorno: pool, ou NULL se nenhuma thread pôde ser criada
+ *
+ * As threads sobrevivem entre ordenações e iterações de benchmark, que
+ * antes pagavam pthread_create e pthread_join a cada chamada.
+ */
+PoolOrdenacao *obterPool(int threads)
+{
+    if (!poolIniciado)
+    {
+        iniciarPool(&poolOrdenacao);
+        poolIniciado = 1;
+        atexit(encerrarPoolOrdenacao);
+    }
+
+    return ampliarPool(&poolOrdenacao, threads) > 0 ? &poolOrdenacao : NULL;
+}
+
+/*
+ * Função: limiteInferiorIntervalo
+ * Descrição: primeiro elemento de [inicio, fim) que não é menor que alvo
+ * Parâmetros: vetor, intervalo ordenado, alvo e contexto
+ * Retorno: posição encontrada (fim se todos são menores)
+ */
+int limiteInferiorIntervalo(const void *base, int inicio, int fim, const void *alvo, ContextoOrdenacao *contexto)
+{
+    while (inicio < fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+
+        if (compararContando(elementoEm((void *)base, meio, contexto), alvo, contexto) < 0)
+        {
+            inicio = meio + 1;
+        }
+        else
+        {
+            fim = meio;
+        }
+    }
+
+    return inicio;
+}
+
+/*
+ * Função: fatiarIntercalacao
+ * Descrição: gera as tarefas que intercalam A e B em fatias independentes
+ * Parâmetros: tarefas (destino), origem, destino, intervalos A e B,
+ *             número de fatias e contexto (conta as buscas binárias)
+ * Retorno: tarefas geradas
+ */
+int fatiarIntercalacao(TarefaOrdenacao *tarefas, const void *origem, void *destino,
+                       int inicioA, int fimA, int inicioB, int fimB, int fatias,
+                       ContextoOrdenacao *contexto)
+{
+    int anteriorA = inicioA;
+    int anteriorB = inicioB;
+    int geradas = 0;
+
+    for (int f = 1; f <= fatias; f++)
+    {
+        int corteA = fimA;
+        int corteB = fimB;
+
+        if (f < fatias)
+        {
+            corteA = inicioA + (int)((long long)(fimA - inicioA) * f / fatias);
+            corteB = (corteA < fimA)
+                         ? limiteInferiorIntervalo(origem, anteriorB, fimB, elementoEm((void *)origem, corteA, contexto), contexto)
+                         : fimB;
+        }
+
+        if (corteA > anteriorA || corteB > anteriorB)
+        {
+            TarefaOrdenacao *tarefa = &tarefas[geradas++];
+
+            tarefa->intercalar = 1;
+            tarefa->origem = origem;
+            tarefa->destino = destino;
+            tarefa->inicioA = anteriorA;
+            tarefa->fimA = corteA;
+            tarefa->inicioB = anteriorB;
+            tarefa->fimB = corteB;
+            tarefa->posicaoDestino = anteriorA + (anteriorB - inicioB);
+        }
+
+        anteriorA = corteA;
+        anteriorB = corteB;
+    }
+
+    return geradas;
+}
+
+/*
+ * Função: mergeSortParalelo
+ * Descrição: Merge Sort com o pool de threads compartilhado
+ * Parâmetros: vetor, quantidade, contexto e número de threads
+ * Retorno: nenhum (comparações e bytes somados em contexto)
+ *
+ * Com uma thread, pouca memória ou menos de 2 * corteSequencial
+ * elementos, ordena sequencialmente. Estável. Nenhuma rodada tem mais
+ * tarefas que threads, então o paralelismo fica limitado ao pedido
+ * mesmo que o pool (obterPool) tenha mais threads.
+ */
+void mergeSortParalelo(void *base, int n, ContextoOrdenacao *contexto, int threads)
+{
+    int blocos = threads;
+    if (blocos > n / corteSequencial)
+    {
+        blocos = n / corteSequencial;
+    }
+
+    if (blocos < 2)
+    {
+        mergeSortGenerico(base, n, contexto);
+        return;
+    }
+
+    size_t marca = marcaArena();
+    void *auxiliar = reservarArena((size_t)n * contexto->tamanho);
+    int *limites = (int *)reservarArena((blocos + 1) * sizeof(int));
+    TarefaOrdenacao *tarefas = (TarefaOrdenacao *)reservarArena((threads + blocos) * sizeof(TarefaOrdenacao));
+    PoolOrdenacao *pool = obterPool(threads);
+
+    if (auxiliar == NULL || limites == NULL || tarefas == NULL || pool == NULL)
+    {
+        liberarArena(marca);
+        mergeSortGenerico(base, n, contexto);
+        return;
+    }
+
+    for (int b = 0; b <= blocos; b++)
+    {
+        limites[b] = (int)((long long)n * b / blocos);
+    }
+
+    // Rodada 0: cada bloco é ordenado por uma thread
+    for (int b = 0; b < blocos; b++)
+    {
+        tarefas[b].intercalar = 0;
+        tarefas[b].destino = base;
+        tarefas[b].auxiliar = auxiliar;
+        tarefas[b].inicioA = limites[b];
+        tarefas[b].fimA = limites[b + 1];
+        tarefas[b].contexto = *contexto;
+        tarefas[b].contexto.comparacoes = 0;
+        tarefas[b].contexto.bytesMovidos = 0;
+    }
+    executarRodada(pool, tarefas, blocos);
+
+    long long comparacoes = 0;
+    long long bytesMovidos = 0;
+    for (int b = 0; b < blocos; b++)
+    {
+        comparacoes += tarefas[b].contexto.comparacoes;
+        bytesMovidos += tarefas[b].contexto.bytesMovidos;
+    }
+
+    // Rodadas de intercalação: a cada uma, os pares de blocos viram um
+    void *origem = base;
+    void *destino = auxiliar;
+
+    for (int largura = 1; largura < blocos; largura *= 2)
+    {
+        int pares = (blocos + 2 * largura - 1) / (2 * largura);
+        int fatias = threads / pares > 1 ? threads / pares : 1;
+        int total = 0;
+
+        for (int b = 0; b < blocos; b += 2 * largura)
+        {
+            int meio = (b + largura < blocos) ? b + largura : blocos;
+            int fim = (b + 2 * largura < blocos) ? b + 2 * largura : blocos;
+
+            total += fatiarIntercalacao(&tarefas[total], origem, destino, limites[b], limites[meio],
+                                        limites[meio], limites[fim], (meio < fim) ? fatias : 1, contexto);
+        }
+
+        for (int t = 0; t < total; t++)
+        {
+            tarefas[t].contexto = *contexto;
+            tarefas[t].contexto.comparacoes = 0;
+            tarefas[t].contexto.bytesMovidos = 0;
+        }
+        executarRodada(pool, tarefas, total);
+
+        for (int t = 0; t < total; t++)
+        {
+            comparacoes += tarefas[t].contexto.comparacoes;
+            bytesMovidos += tarefas[t].contexto.bytesMovidos;
+        }
+
+        void *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+
+    // Número ímpar de rodadas: o resultado ficou no rascunho
+    if (origem != base)
+    {
+        memcpy(base, origem, (size_t)n * contexto->tamanho);
+        bytesMovidos += (long long)n * (long long)contexto->tamanho;
+    }
+
+    // As buscas binárias do fatiamento já foram contadas em contexto
+    contexto->comparacoes += comparacoes;
+    contexto->bytesMovidos += bytesMovidos;
+
+    liberarArena(marca);
+}
+
+/* ========================================
+ * ALGORITMOS DE ORDENAÇÃO COM CONTADORES
+ * ======================================== */
+
+/*
+ * Função: bubbleSortNome
+ * Descrição: ordena componentes por NOME usando Bubble Sort
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²)
+ * Melhor caso: O(n) - já ordenado
+ * Pior caso: O(n²) - ordem reversa
+ *
+ * Como funciona:
+ * - Compara elementos adjacentes
+ * - Troca se estiverem na ordem errada
+ * - Repete até não haver mais trocas
+ */
+void bubbleSortNome()
+{
+    printf("\n⏳ Executando BUBBLE SORT por NOME...\n");
+    comparacoesBubble = (int)ordenarTorre(ALGORITMO_BUBBLE, CHAVE_NOME);
+    printf("✅ Bubble Sort concluído!\n");
+}
+
+/*
+ * Função: insertionSortTipo
+ * Descrição: ordena componentes por TIPO usando Insertion Sort
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(n²)
+ * Melhor caso: O(n) - já ordenado
+ * Pior caso: O(n²) - ordem reversa
+ *
+ * Como funciona:
+ * - Percorre cada elemento
+ * - Insere na posição correta entre os anteriores
+ * - Eficiente para poucos elementos
+ * - Cada comparação é entre dois inteiros: a posição alfabética dos
+ *   tipos no dicionário de tipos, sem ler os nomes
+ */
+void insertionSortTipo()
+{
+    printf("\n⏳ Executando INSERTION SORT por TIPO...\n");
+    comparacoesInsertion = (int)ordenarTorre(ALGORITMO_INSERTION, CHAVE_TIPO);
+    printf("✅ Insertion Sort concluído!\n");
+}
+
+/*
+ * Função: ordenarPrioridade
+ * Descrição: ordena componentes por PRIORIDADE (decrescente)
+ * Parâmetros: nenhum
+ * Retorno: comparações realizadas, ou -1 se faltou memória (a torre
+ *          fica como estava)
+ *
+ * Prioridade só vai de 1 a 10, então o motor escolhe o Counting Sort:
+ * O(n + 10), sem comparações, e ESTÁVEL (empates mantêm a ordem
+ * anterior - ex: ordenar por nome e depois por prioridade deixa cada
+ * faixa de prioridade em ordem alfabética). Se o Counting Sort não
+ * conseguir memória, o motor cai no Insertion Sort; o algoritmo usado
+ * fica em ultimoAlgoritmo.
+ */
+long long ordenarPrioridade()
+{
+    printf("\n⏳ Ordenando por PRIORIDADE (escolha automática)...\n");
+    long long comparacoes = ordenarTorre(ALGORITMO_AUTOMATICO, CHAVE_PRIORIDADE);
+    if (comparacoes >= 0)
+    {
+        printf("✅ %s concluído!\n", NOMES_ALGORITMOS[ultimoAlgoritmo]);
+    }
+    return comparacoes;
+}
+
+/* ========================================
+ * BUSCA BINÁRIA
+ * ======================================== */
+
+/*
+ * Função: buscaBinariaPorNome
+ * Descrição: busca componente por nome no índice de nomes
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(log n)
+ * O índice de nomes é mantido a cada inserção e remoção, então a busca
+ * funciona com torre em qualquer ordem e nunca encontra lápides.
+ *
+ * Como funciona:
+ * - Divide o espaço de busca pela metade a cada comparação
+ * - MUITO mais rápido que busca sequencial para muitos dados
+ */
+void buscaBinariaPorNome()
+{
+    printf("\n%s\n", LINHA);
+    printf("      🔦 BUSCA BINÁRIA POR NOME 🔦\n");
+    printf("%s\n", LINHA);
+
+    if (totalComponentes == 0)
+    {
+        printf("⚠️  Torre vazia!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    char nome[30];
+    printf("Digite o nome do componente a buscar: ");
+    fgets(nome, sizeof(nome), stdin);
+    nome[strcspn(nome, "\n")] = 0;
+
+    int comparacoes = 0;
+    int encontrado = localizarPorNome(nome, &comparacoes);
+
+    if (encontrado != -1)
+    {
+        printf("\n✅ COMPONENTE ENCONTRADO! ⚡\n\n");
+        printf("📌 Nome: %s\n", torre[encontrado].nome);
+        printf("🏷️  Tipo: %s\n", nomeDoTipo(torre[encontrado].tipo));
+        printf("⭐ Prioridade: %d\n", torre[encontrado].prioridade);
+        printf("📊 Quantidade: %d\n", torre[encontrado].quantidade);
+
+        // Simula ativação
+        if (strcmp(torre[encontrado].nome, "chip central") == 0 ||
+            strcmp(torre[encontrado].nome, "cristal energético") == 0 ||
+            strcmp(torre[encontrado].nome, "núcleo de controle") == 0)
+        {
+            printf("\n🚀 Este é um componente-CHAVE! Pode ativar a torre!\n");
+        }
+    }
+    else
+    {
+        printf("\n❌ Componente '%s' não encontrado!\n", nome);
+    }
+
+    printf("\n📊 Estatísticas da busca:\n");
+    printf("   Comparações realizadas: %d\n", comparacoes);
+    printf("   Complexidade: O(log n) ⚡\n");
+
+    // Cálculo teórico
+    int comparacoesTeoricas = 0;
+    int temp = totalComponentes;
+    while (temp > 1)
+    {
+        temp /= 2;
+        comparacoesTeoricas++;
+    }
+    printf("   Máx comparações teóricas: ~%d\n", comparacoesTeoricas);
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * MENUS DE ORDENAÇÃO
+ * ======================================== */
+
+/*
+ * Função: exibirMovimentacao
+ * Descrição: mostra os bytes movidos pela última ordenação
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void exibirMovimentacao()
+{
+    printf("   Modo: %s\n", NOMES_MODOS[modoOrdenacao]);
+    printf("   Bytes movidos: %lld na ordenação", bytesMovidosOrdenacao);
+    if (modoOrdenacao != MODO_REGISTROS)
+    {
+        printf(" + %lld ao aplicar a permutação", bytesMovidosAplicacao);
+    }
+    printf("\n");
+}
+
+/*
+ * Função: lerChaveOrdenacao
+ * Descrição: pergunta ao jogador a chave de ordenação
+ * Parâmetros: nenhum
+ * Retorno: ChaveOrdenacao escolhida ou -1 se inválida
+ */
+int lerChaveOrdenacao()
+{
+    printf("\nChaves:\n");
+    for (int c = 0; c < TOTAL_CHAVES; c++)
+    {
+        printf("  %d - %s\n", c + 1, NOMES_CHAVES[c]);
+    }
+    printf("Escolha a chave (1-%d): ", TOTAL_CHAVES);
+
+    int chave;
+    scanf("%d", &chave);
+    getchar();
+
+    if (chave < 1 || chave > TOTAL_CHAVES)
+    {
+        printf("❌ Chave inválida!\n");
+        return -1;
+    }
+
+    return chave - 1;
+}
+
+/*
+ * Função: exibirVisaoOrdenada
+ * Descrição: lista os componentes em ordem de uma chave sem mover torre
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Nome, tipo e prioridade vêm prontos dos índices secundários; as
+ * demais chaves ordenam só índices. Em ambos os casos os componentes
+ * são lidos através da permutação e torre e handles ficam intactos.
+ */
+void exibirVisaoOrdenada()
+{
+    int chave = lerChaveOrdenacao();
+    if (chave < 0)
+    {
+        return;
+    }
+
+    size_t marca = marcaArena();
+    int *ordem = (int *)reservarArena(totalComponentes * sizeof(int));
+    if (ordem == NULL)
+    {
+        liberarArena(marca);
+        printf("❌ Erro: memória insuficiente!\n");
+        return;
+    }
+
+    ContextoOrdenacao contexto;
+    int n = totalComponentes;
+
+    if (chave < TOTAL_INDICES)
+    {
+        ordemDoIndice((ChaveOrdenacao)chave, ordem);
+        printf("\n🔎 Visão por %s (índice mantido, 0 comparações)\n", NOMES_CHAVES[chave]);
+    }
+    else if ((n = calcularOrdem(MODO_INDICES, ALGORITMO_AUTOMATICO, (ChaveOrdenacao)chave, ordem, &contexto)) >= 0)
+    {
+        printf("\n🔎 Visão por %s (%s, %lld comparações, %lld bytes movidos)\n",
+               NOMES_CHAVES[chave], NOMES_ALGORITMOS[ultimoAlgoritmo],
+               contexto.comparacoes, contexto.bytesMovidos);
+    }
+
+    if (n >= 0)
+    {
+        ordemExibicao = ordem;
+        exibirComponentes(1);
+        ordemExibicao = NULL;
+    }
+    else
+    {
+        printf("❌ Erro: memória insuficiente!\n");
+    }
+
+    liberarArena(marca);
+}
+
+/*
+ * Função: nomeSintetico
+ * Descrição: gera o nome do i-ésimo componente sintético
+ * Parâmetros: destino (30 bytes) e número do componente
+ * Retorno: nenhum
+ *
+ * Embaralha o número (splitmix64) para que a ordem de geração não
+ * coincida com a ordem alfabética. Os dígitos vêm antes de "peca" para
+ * que os 8 bytes do prefixo de ordenação não sejam iguais em todos.
+ */
+void nomeSintetico(char *nome, long long numero)
+{
+    unsigned long long x = (unsigned long long)numero + 0x9E3779B97F4A7C15ULL;
+
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+
+    snprintf(nome, 30, "%016llxpeca", x);
+}
+
+/*
+ * Função: relatorioEscalabilidade
+ * Descrição: mede o Merge Sort paralelo com 1..threadsOrdenacao threads
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Ordena N chaves sintéticas (decoradas por nome) partindo sempre da
+ * mesma entrada, confere o resultado e mostra tempo de parede,
+ * speedup e eficiência em relação a uma thread.
+ */
+void relatorioEscalabilidade()
+{
+    int n;
+    printf("Quantidade de componentes sintéticos (ex: 1000000): ");
+    scanf("%d", &n);
+    getchar();
+
+    if (n < 1 || n > MAXIMO_ESCALABILIDADE)
+    {
+        printf("❌ Quantidade deve estar entre 1 e %d!\n", MAXIMO_ESCALABILIDADE);
+        return;
+    }
+
+    ElementoOrdenacao *original = (ElementoOrdenacao *)malloc((size_t)n * sizeof(ElementoOrdenacao));
+    ElementoOrdenacao *trabalho = (ElementoOrdenacao *)malloc((size_t)n * sizeof(ElementoOrdenacao));
+
+    if (original == NULL || trabalho == NULL)
+    {
+        printf("❌ Erro: memória insuficiente!\n");
+        free(original);
+        free(trabalho);
+        return;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        original[i].numero = 0;
+        nomeSintetico(original[i].texto, i);
+        original[i].prefixo = prefixoTexto(original[i].texto);
+        original[i].origem = i;
+    }
+
+    printf("\n%s\n", LINHA);
+    printf("   📈 ESCALABILIDADE - %s\n", NOMES_ALGORITMOS[ALGORITMO_PARALELO]);
+    printf("   N = %d | corte sequencial = %d\n", n, corteSequencial);
+    printf("%s\n", LINHA);
+    printf("│ Threads │   Tempo (s)  │ Speedup │ Eficiência │    Comparações   │\n");
+
+    double tempoUmaThread = 0.0;
+
+    for (int threads = 1; threads <= threadsOrdenacao; threads++)
+    {
+        ContextoOrdenacao contexto = {sizeof(ElementoOrdenacao), compararElementos, NULL, 0, 0};
+
+        memcpy(trabalho, original, (size_t)n * sizeof(ElementoOrdenacao));
+
+        double inicio = relogioSegundos();
+        mergeSortParalelo(trabalho, n, &contexto, threads);
+        double tempo = relogioSegundos() - inicio;
+
+        int ordenado = 1;
+        for (int i = 1; i < n && ordenado; i++)
+        {
+            ordenado = compararElementos(&trabalho[i - 1], &trabalho[i]) <= 0;
+        }
+
+        if (threads == 1)
+        {
+            tempoUmaThread = tempo;
+        }
+
+        double speedup = (tempo > 0.0) ? tempoUmaThread / tempo : 0.0;
+
+        printf("│ %7d │ %12.6f │ %6.2fx │ %9.1f%% │ %16lld │%s\n",
+               threads, tempo, speedup, 100.0 * speedup / threads, contexto.comparacoes,
+               ordenado ? "" : " ❌ fora de ordem!");
+    }
+
+    printf("%s\n", LINHA);
+
+    free(trabalho);
+    free(original);
+    devolverArena();
+}
+
+/*
+ * Função: configurarParalelismo
+ * Descrição: ajusta o número de threads e o corte sequencial
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void configurarParalelismo()
+{
+    int threads, corte;
+
+    printf("Número de threads (1-%d, núcleos: %d): ", MAXIMO_THREADS, contarNucleos());
+    scanf("%d", &threads);
+    getchar();
+
+    if (threads < 1 || threads > MAXIMO_THREADS)
+    {
+        printf("❌ Número de threads inválido!\n");
+        return;
+    }
+
+    printf("Corte sequencial (mínimo de elementos por bloco, >= %d): ", LIMIAR_INSERCAO_MERGE);
+    scanf("%d", &corte);
+    getchar();
+
+    if (corte < LIMIAR_INSERCAO_MERGE)
+    {
+        printf("❌ Corte sequencial inválido!\n");
+        return;
+    }
+
+    threadsOrdenacao = threads;
+    corteSequencial = corte;
+    printf("✅ Paralelismo: %d thread(s), corte sequencial de %d elementos.\n", threadsOrdenacao, corteSequencial);
+}
+
+/*
+ * Função: menuOrdenacao
+ * Descrição: apresenta opções de ordenação com análise de desempenho
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void menuOrdenacao()
+{
+    int opcao;
+
+    while (1)
     {
         printf("\n%s\n", LINHA);
         printf("      ⬆️ ESCOLHA UM ALGORITMO DE ORDENAÇÃO ⬆️\n");
@@ -523,238 +3214,990 @@ void menuOrdenacao()
         printf("Escolha uma opção:\n\n");
         printf("  1️⃣  - BUBBLE SORT (ordena por NOME)\n");
         printf("  2️⃣  - INSERTION SORT (ordena por TIPO)\n");
-        printf("  3️⃣  - SELECTION SORT (ordena por PRIORIDADE)\n");
-        printf("  4️⃣  - Comparar os 3 algoritmos\n");
-        printf("  5️⃣  - Voltar ao menu principal\n");
+        printf("  3️⃣  - COUNTING SORT (ordena por PRIORIDADE, automático)\n");
+        printf("  4️⃣  - Comparar os algoritmos (mesma chave)\n");
+        printf("  5️⃣  - Ordenação personalizada (algoritmo x chave)\n");
+        printf("  6️⃣  - Ver em ordem sem mover a torre (índices)\n");
+        printf("  7️⃣  - Trocar modo de ordenação (atual: %s)\n", NOMES_MODOS[modoOrdenacao]);
+        printf("  8️⃣  - Configurar paralelismo (%d thread(s), corte %d)\n", threadsOrdenacao, corteSequencial);
+        printf("  9️⃣  - Relatório de escalabilidade (1..%d threads)\n", threadsOrdenacao);
+        printf("  🔟 - Voltar ao menu principal\n");
         printf("%s\n", LINHA);
-        printf("Digite sua opção (1-5): ");
+        printf("Digite sua opção (1-10): ");
         scanf("%d", &opcao);
         getchar();
 
-        clock_t inicio, fim;
-        double tempo;
+        double inicio, fim;
+        double tempo;
+
+        switch (opcao)
+        {
+        case 1:
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("     🔄 BUBBLE SORT - ORDENANDO POR NOME\n");
+            printf("%s\n", LINHA);
+
+            inicio = relogioSegundos();
+            bubbleSortNome();
+            fim = relogioSegundos();
+            tempo = fim - inicio;
+
+            printf("\n📊 DESEMPENHO DO BUBBLE SORT:\n");
+            printf("   Comparações: %d\n", comparacoesBubble);
+            exibirMovimentacao();
+            printf("   Tempo: %.6f segundos\n", tempo);
+            printf("   Complexidade: O(n²)\n");
+            printf("%s\n", LINHA);
+
+            exibirComponentes(0);
+            break;
+
+        case 2:
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("    🔄 INSERTION SORT - ORDENANDO POR TIPO\n");
+            printf("%s\n", LINHA);
+
+            inicio = relogioSegundos();
+            insertionSortTipo();
+            fim = relogioSegundos();
+            tempo = fim - inicio;
+
+            printf("\n📊 DESEMPENHO DO INSERTION SORT:\n");
+            printf("   Comparações: %d\n", comparacoesInsertion);
+            exibirMovimentacao();
+            printf("   Tempo: %.6f segundos\n", tempo);
+            printf("   Complexidade: O(n²)\n");
+            printf("%s\n", LINHA);
+
+            exibirComponentes(0);
+            break;
+
+        case 3:
+        {
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("   🔄 ORDENANDO POR PRIORIDADE (escolha automática)\n");
+            printf("%s\n", LINHA);
+
+            inicio = relogioSegundos();
+            long long comparacoes = ordenarPrioridade();
+            fim = relogioSegundos();
+            tempo = fim - inicio;
+
+            if (comparacoes < 0)
+            {
+                printf("❌ Erro: memória insuficiente para ordenar!\n");
+                printf("%s\n", LINHA);
+                break;
+            }
+
+            printf("\n📊 DESEMPENHO (%s):\n", NOMES_ALGORITMOS[ultimoAlgoritmo]);
+            if (ultimoAlgoritmo == ALGORITMO_CONTAGEM)
+            {
+                printf("   Comparações: %lld (conta as chaves em vez de comparar)\n", comparacoes);
+                exibirMovimentacao();
+                printf("   Tempo: %.6f segundos\n", tempo);
+                printf("   Complexidade: O(n + k), k = 10 prioridades\n");
+            }
+            else
+            {
+                printf("   Comparações: %lld\n", comparacoes);
+                exibirMovimentacao();
+                printf("   Tempo: %.6f segundos\n", tempo);
+                printf("   Complexidade: O(n²)\n");
+            }
+            printf("%s\n", LINHA);
+
+            exibirComponentes(0);
+            break;
+        }
+
+        case 4:
+        {
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            int chave = lerChaveOrdenacao();
+            if (chave < 0)
+            {
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("   📈 COMPARAÇÃO DOS ALGORITMOS 📈\n");
+            printf("   Chave: %s | Modo: %s\n", NOMES_CHAVES[chave], NOMES_MODOS[modoOrdenacao]);
+            printf("%s\n", LINHA);
+
+            // Cada execução ordena a sua própria cópia decorada da mesma chave
+            long long comparacoes[TOTAL_ALGORITMOS];
+            EstatisticasTempo tempos[TOTAL_ALGORITMOS];
+            AlgoritmoOrdenacao usados[TOTAL_ALGORITMOS];
+            long long bytes[TOTAL_ALGORITMOS];
+            int faltouMemoria = 0;
+            long long reservasAntes = arenaOrdenacao.reservas;
+            long long alocacoesAntes = arenaOrdenacao.alocacoesHeap;
+
+            for (int a = 0; a < TOTAL_ALGORITMOS; a++)
+            {
+                printf("⏳ Executando %s...\n", NOMES_ALGORITMOS[a]);
+                comparacoes[a] = medirAlgoritmo((AlgoritmoOrdenacao)a, (ChaveOrdenacao)chave, &tempos[a]);
+                usados[a] = ultimoAlgoritmo;
+                bytes[a] = bytesMovidosOrdenacao;
+                faltouMemoria = faltouMemoria || comparacoes[a] < 0;
+            }
+
+            if (faltouMemoria)
+            {
+                printf("❌ Erro: memória insuficiente para medir!\n");
+                break;
+            }
+
+            comparacoesBubble = (int)comparacoes[ALGORITMO_BUBBLE];
+            comparacoesInsertion = (int)comparacoes[ALGORITMO_INSERTION];
+            comparacoesSelection = (int)comparacoes[ALGORITMO_SELECTION];
+
+            // Exibe resultados
+            printf("\n%s\n", LINHA);
+            printf("   📊 RESULTADOS COMPARATIVOS\n");
+            printf("   Tempos em µs: %d execuções por algoritmo após %d de aquecimento\n",
+                   EXECUCOES_MEDICAO, EXECUCOES_AQUECIMENTO);
+            printf("   Relógio monotônico, resolução de %.0f ns\n", resolucaoRelogio() * 1e9);
+            exibirEstatisticasArena(reservasAntes, alocacoesAntes);
+            printf("%s\n", LINHA);
+
+            for (int a = 0; a < TOTAL_ALGORITMOS; a++)
+            {
+                printf("\n%d️⃣  %s (por %s):\n", a + 1, NOMES_ALGORITMOS[a], NOMES_CHAVES[chave]);
+                if (usados[a] != (AlgoritmoOrdenacao)a)
+                {
+                    printf("   ⚠️  Não se aplica a esta chave: usou %s\n", NOMES_ALGORITMOS[usados[a]]);
+                }
+                printf("   Comparações: %lld\n", comparacoes[a]);
+                printf("   Bytes movidos: %lld\n", bytes[a]);
+                printf("   Tempo: mediana %.3f | p90 %.3f | p99 %.3f | mín %.3f\n",
+                       tempos[a].mediana * 1e6, tempos[a].p90 * 1e6, tempos[a].p99 * 1e6, tempos[a].minimo * 1e6);
+                printf("          média %.3f ± %.3f (desvio padrão)\n",
+                       tempos[a].media * 1e6, tempos[a].desvio * 1e6);
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("   💡 ANÁLISE\n");
+            printf("%s\n", LINHA);
+
+            if (totalComponentes <= 5)
+            {
+                printf("\nPara %d componentes:\n", totalComponentes);
+                printf("✓ Todos os algoritmos são RÁPIDOS\n");
+                printf("✓ Diferenças de tempo são negligenciáveis\n");
+            }
+            else
+            {
+                printf("\nPara %d componentes:\n", totalComponentes);
+
+                if (comparacoesBubble > comparacoesInsertion)
+                {
+                    printf("🏆 INSERTION SORT é mais eficiente que Bubble Sort\n");
+                    printf("   Economia: %d comparações\n", comparacoesBubble - comparacoesInsertion);
+                }
+
+                if (comparacoesSelection < comparacoesBubble)
+                {
+                    printf("🏆 SELECTION SORT é competitivo\n");
+                }
+            }
+
+            printf("\n📌 CONCLUSÃO EDUCACIONAL:\n");
+            printf("✓ O(n²) é aceitável para dados pequenos (<100)\n");
+            printf("✓ Para dados maiores, use O(n log n) (Quick/Merge/Heap Sort)\n");
+            printf("✓ Insertion Sort: melhor para dados quase ordenados\n");
+            printf("✓ Selection Sort: número fixo de iterações\n");
+            printf("✓ Counting Sort: O(n + k) para chaves inteiras de domínio pequeno\n");
+            printf("✓ Merge Sort: O(n log n) e estável; a versão paralela usa o corte\n");
+            printf("  sequencial e só divide o trabalho entre threads com muitos dados\n");
+
+            printf("%s\n", LINHA);
+            break;
+        }
+
+        case 5:
+        {
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            printf("\nAlgoritmos:\n");
+            printf("  0 - Automático (Counting Sort se a chave permitir)\n");
+            for (int a = 0; a < TOTAL_ALGORITMOS; a++)
+            {
+                printf("  %d - %s\n", a + 1, NOMES_ALGORITMOS[a]);
+            }
+            printf("Escolha o algoritmo (0-%d): ", TOTAL_ALGORITMOS);
+
+            int algoritmo;
+            scanf("%d", &algoritmo);
+            getchar();
+
+            if (algoritmo < 0 || algoritmo > TOTAL_ALGORITMOS)
+            {
+                printf("❌ Algoritmo inválido!\n");
+                break;
+            }
+            algoritmo = (algoritmo == 0) ? ALGORITMO_AUTOMATICO : algoritmo - 1;
+
+            int chave = lerChaveOrdenacao();
+            if (chave < 0)
+            {
+                break;
+            }
+
+            printf("\n%s\n", LINHA);
+            printf("   🔄 ORDENANDO POR %s\n", NOMES_CHAVES[chave]);
+            printf("%s\n", LINHA);
+
+            inicio = relogioSegundos();
+            long long comparacoes = ordenarTorre((AlgoritmoOrdenacao)algoritmo, (ChaveOrdenacao)chave);
+            fim = relogioSegundos();
+            tempo = fim - inicio;
+
+            if (comparacoes < 0)
+            {
+                printf("❌ Erro: memória insuficiente para ordenar!\n");
+                break;
+            }
+
+            printf("\n📊 DESEMPENHO (%s):\n", NOMES_ALGORITMOS[ultimoAlgoritmo]);
+            printf("   Comparações: %lld\n", comparacoes);
+            exibirMovimentacao();
+            printf("   Tempo: %.6f segundos\n", tempo);
+            printf("%s\n", LINHA);
+
+            exibirComponentes(0);
+            break;
+        }
+
+        case 6:
+            if (totalComponentes == 0)
+            {
+                printf("\n⚠️  Torre vazia!\n");
+                break;
+            }
+
+            exibirVisaoOrdenada();
+            break;
+
+        case 7:
+            modoOrdenacao = (ModoOrdenacao)((modoOrdenacao + 1) % TOTAL_MODOS);
+            printf("\n✅ Modo de ordenação: %s\n", NOMES_MODOS[modoOrdenacao]);
+            printf("   Cada elemento movido ocupa %zu bytes.\n",
+                   contextoParaModo(modoOrdenacao, CHAVE_NOME).tamanho);
+            break;
+
+        case 8:
+            configurarParalelismo();
+            break;
+
+        case 9:
+            relatorioEscalabilidade();
+            break;
+
+        case 10:
+            return;
+
+        default:
+            printf("❌ Opção inválida!\n");
+        }
+    }
+}
+
+/* ========================================
+ * USO DE COMPONENTES POR HANDLE
+ * ======================================== */
+
+/*
+ * Função: usarComponente
+ * Descrição: consome unidades de um componente a partir do handle
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Complexidade: O(1) - não há busca por nome
+ * O componente sai da torre quando a quantidade chega a zero.
+ */
+void usarComponente()
+{
+    printf("\n%s\n", LINHA);
+    printf("      🔧 USAR COMPONENTE (HANDLE) 🔧\n");
+    printf("%s\n", LINHA);
+
+    char texto[32];
+    Handle handle;
+    char resto;
+
+    printf("Digite o handle do componente (ex: 3:1): ");
+    fgets(texto, sizeof(texto), stdin);
+    texto[strcspn(texto, "\n")] = 0;
+
+    int indice = -1;
+    if (sscanf(texto, "%d:%u%c", &handle.slot, &handle.geracao, &resto) == 2)
+    {
+        indice = resolverHandle(handle);
+    }
+
+    if (indice == -1)
+    {
+        printf("❌ Handle '%s' inválido ou de componente removido!\n", texto);
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    int unidades;
+    printf("Quantas unidades de '%s' usar (disponível: %d)? ",
+           torre[indice].nome, torre[indice].quantidade);
+    scanf("%d", &unidades);
+    getchar();
+
+    if (unidades <= 0 || unidades > torre[indice].quantidade)
+    {
+        printf("❌ Erro: quantidade inválida!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    torre[indice].quantidade -= unidades;
+
+    if (torre[indice].quantidade == 0)
+    {
+        printf("✅ Último '%s' usado. Componente retirado da torre!\n", torre[indice].nome);
+        removerPosicao(indice);
+    }
+    else
+    {
+        printf("✅ '%s' usado! Restam %d unidade(s).\n", torre[indice].nome, torre[indice].quantidade);
+    }
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * BENCHMARK DE DISTRIBUIÇÕES
+ * ========================================
+ *
+ * Roda todos os algoritmos do motor sobre a MESMA chave e a MESMA
+ * entrada, para cada distribuição (aleatória, ordenada, invertida,
+ * poucos únicos e quase ordenada) e N = 10, 100, ... até o máximo.
+ * As chaves são geradas como postos inteiros e gravadas como texto
+ * ("00000042peca": os dígitos que variam ficam no prefixo de 8 bytes,
+ * comparado como inteiro + SSE2) ou como número (o que permite o
+ * Counting Sort quando o domínio é pequeno).
+ *
+ * Cada medição copia a entrada original antes de cada execução e
+ * repete até somar TEMPO_MINIMO_MEDICAO; a saída é CSV ou JSON, com
+ * comparações, movimentos (elementos copiados), bytes e tempo de
+ * parede. Os algoritmos O(n²) só rodam até LIMITE_QUADRATICO_BENCHMARK.
+ * torre não é usada nem alterada.
+ */
+
+#define MAXIMO_BENCHMARK 10000000
+#define LIMITE_QUADRATICO_BENCHMARK 10000 // Maior N para Bubble, Insertion e Selection
+#define TEMPO_MINIMO_MEDICAO 0.01         // Segundos somados por medição
+#define MAXIMO_EXECUCOES_MEDICAO 1000
+#define VALORES_POUCOS_UNICOS 8           // Chaves distintas em "poucos_unicos"
+
+typedef enum
+{
+    DISTRIBUICAO_ALEATORIA,
+    DISTRIBUICAO_ORDENADA,
+    DISTRIBUICAO_INVERTIDA,
+    DISTRIBUICAO_POUCOS_UNICOS,
+    DISTRIBUICAO_QUASE_ORDENADA,
+    TOTAL_DISTRIBUICOES
+} DistribuicaoBenchmark;
+
+const char *NOMES_DISTRIBUICOES[TOTAL_DISTRIBUICOES] = {"aleatoria", "ordenada", "invertida",
+                                                        "poucos_unicos", "quase_ordenada"};
+
+/*
+ * Função: sortearBenchmark
+ * Descrição: gerador pseudoaleatório determinístico (splitmix64)
+ * Parâmetros: estado do gerador
+ * Retorno: próximo número de 64 bits
+ */
+unsigned long long sortearBenchmark(unsigned long long *estado)
+{
+    unsigned long long x = (*estado += 0x9E3779B97F4A7C15ULL);
+
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/*
+ * Função: gerarDistribuicao
+ * Descrição: preenche N elementos com chaves de uma distribuição
+ * Parâmetros: vetor, N, distribuição e 1 para chave inteira (0 = texto)
+ * Retorno: nenhum
+ *
+ * A semente é fixa: a mesma (distribuição, N) gera sempre a mesma entrada.
+ */
+void gerarDistribuicao(ElementoOrdenacao *elementos, int n, DistribuicaoBenchmark distribuicao, int chaveInteira)
+{
+    unsigned long long estado = 42 + (unsigned long long)distribuicao;
+
+    for (int i = 0; i < n; i++)
+    {
+        int posto;
+
+        switch (distribuicao)
+        {
+        case DISTRIBUICAO_ALEATORIA:
+            posto = (int)(sortearBenchmark(&estado) % (unsigned long long)n);
+            break;
+
+        case DISTRIBUICAO_INVERTIDA:
+            posto = n - 1 - i;
+            break;
+
+        case DISTRIBUICAO_POUCOS_UNICOS:
+            posto = (int)(sortearBenchmark(&estado) % VALORES_POUCOS_UNICOS);
+            break;
+
+        default:
+            posto = i;
+            break;
+        }
+
+        elementos[i].numero = posto;
+        elementos[i].origem = i;
+        elementos[i].texto[0] = '\0';
+        if (!chaveInteira)
+        {
+            elementos[i].numero = 0;
+            snprintf(elementos[i].texto, sizeof(elementos[i].texto), "%08dpeca", posto);
+        }
+        elementos[i].prefixo = prefixoTexto(elementos[i].texto);
+    }
+
+    // Quase ordenada: ~1% de pares trocados ao acaso
+    if (distribuicao == DISTRIBUICAO_QUASE_ORDENADA)
+    {
+        int trocas = n / 100 > 0 ? n / 100 : 1;
+
+        for (int t = 0; t < trocas && n > 1; t++)
+        {
+            int a = (int)(sortearBenchmark(&estado) % (unsigned long long)n);
+            int b = (int)(sortearBenchmark(&estado) % (unsigned long long)n);
+            ElementoOrdenacao temp = elementos[a];
+            elementos[a] = elementos[b];
+            elementos[b] = temp;
+        }
+    }
+}
+
+/*
+ * Função: algoritmoQuadratico
+ * Descrição: diz se o algoritmo vai rodar em O(n²) sobre a entrada
+ * Parâmetros: algoritmo, vetor, N e contexto
+ * Retorno: 1 se O(n²), 0 caso contrário
+ *
+ * Counting Sort é O(n + k) quando o domínio cabe; senão o motor cai no
+ * Insertion Sort.
+ */
+int algoritmoQuadratico(AlgoritmoOrdenacao algoritmo, void *base, int n, const ContextoOrdenacao *contexto)
+{
+    int minimo;
+
+    switch (algoritmo)
+    {
+    case ALGORITMO_BUBBLE:
+    case ALGORITMO_INSERTION:
+    case ALGORITMO_SELECTION:
+        return 1;
+
+    case ALGORITMO_CONTAGEM:
+        return dominioChaves(base, n, contexto, &minimo) == 0;
+
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Função: medirDistribuicao
+ * Descrição: mede um algoritmo sobre uma entrada e escreve o resultado
+ * Parâmetros: algoritmo, entrada original, rascunho, N, contexto base,
+ *             distribuição, nome da chave, saída, formato e contador de
+ *             medições já escritas
+ * Retorno: nenhum
+ */
+void medirDistribuicao(AlgoritmoOrdenacao algoritmo, const ElementoOrdenacao *original, ElementoOrdenacao *trabalho,
+                       int n, const ContextoOrdenacao *base, DistribuicaoBenchmark distribuicao,
+                       const char *chave, FILE *saida, int formatoJson, int *medicoes)
+{
+    double tempos[MAXIMO_EXECUCOES_MEDICAO];
+    double total = 0.0;
+    int execucoes = 0;
+    ContextoOrdenacao contexto = *base;
+
+    while (execucoes < MAXIMO_EXECUCOES_MEDICAO && (execucoes == 0 || total < TEMPO_MINIMO_MEDICAO))
+    {
+        memcpy(trabalho, original, (size_t)n * sizeof(ElementoOrdenacao));
+        contexto = *base;
+
+        double inicio = relogioSegundos();
+        executarAlgoritmo(algoritmo, trabalho, n, &contexto);
+        tempos[execucoes] = relogioSegundos() - inicio;
+
+        total += tempos[execucoes++];
+    }
+
+    int ordenado = 1;
+    for (int i = 1; i < n && ordenado; i++)
+    {
+        ordenado = compararElementos(&trabalho[i - 1], &trabalho[i]) <= 0;
+    }
+
+    EstatisticasTempo estatisticas;
+    calcularEstatisticas(tempos, execucoes, &estatisticas);
+
+    long long movimentos = contexto.bytesMovidos / (long long)contexto.tamanho;
+
+    if (formatoJson)
+    {
+        fprintf(saida, "%s\n    {\"distribuicao\": \"%s\", \"chave\": \"%s\", \"n\": %d, "
+                       "\"algoritmo\": \"%s\", \"algoritmo_usado\": \"%s\", \"execucoes\": %d, "
+                       "\"ns_mediana\": %.0f, \"ns_minimo\": %.0f, \"comparacoes\": %lld, "
+                       "\"movimentos\": %lld, \"bytes_movidos\": %lld, \"ordenado\": %s}",
+                (*medicoes)++ == 0 ? "" : ",", NOMES_DISTRIBUICOES[distribuicao], chave, n,
+                NOMES_ALGORITMOS[algoritmo], NOMES_ALGORITMOS[ultimoAlgoritmo], execucoes,
+                estatisticas.mediana * 1e9, estatisticas.minimo * 1e9, contexto.comparacoes,
+                movimentos, contexto.bytesMovidos, ordenado ? "true" : "false");
+    }
+    else
+    {
+        (*medicoes)++;
+        fprintf(saida, "%s,%s,%d,%s,%s,%d,%.0f,%.0f,%lld,%lld,%lld,%d\n",
+                NOMES_DISTRIBUICOES[distribuicao], chave, n, NOMES_ALGORITMOS[algoritmo],
+                NOMES_ALGORITMOS[ultimoAlgoritmo], execucoes, estatisticas.mediana * 1e9,
+                estatisticas.minimo * 1e9, contexto.comparacoes, movimentos,
+                contexto.bytesMovidos, ordenado);
+    }
+}
+
+/*
+ * Função: executarBenchmark
+ * Descrição: roda todas as distribuições e algoritmos até N máximo
+ * Parâmetros: N máximo, 1 para chave inteira (0 = texto), saída e
+ *             formato (1 = JSON, 0 = CSV)
+ * Retorno: 1 se concluiu, 0 se faltou memória
+ */
+int executarBenchmark(int maximo, int chaveInteira, FILE *saida, int formatoJson)
+{
+    ElementoOrdenacao *original = (ElementoOrdenacao *)malloc((size_t)maximo * sizeof(ElementoOrdenacao));
+    ElementoOrdenacao *trabalho = (ElementoOrdenacao *)malloc((size_t)maximo * sizeof(ElementoOrdenacao));
+
+    if (original == NULL || trabalho == NULL)
+    {
+        free(original);
+        free(trabalho);
+        return 0;
+    }
+
+    const char *chave = chaveInteira ? "inteira" : "texto";
+    ContextoOrdenacao base = {sizeof(ElementoOrdenacao), compararElementos,
+                              chaveInteira ? numeroDoElemento : NULL, 0, 0};
+    int medicoes = 0;
+
+    if (formatoJson)
+    {
+        fprintf(saida, "{\n  \"benchmark\": \"distribuicoes\",\n  \"threads\": %d,\n"
+                       "  \"limite_quadratico\": %d,\n  \"medicoes\": [",
+                threadsOrdenacao, LIMITE_QUADRATICO_BENCHMARK);
+    }
+    else
+    {
+        fprintf(saida, "distribuicao,chave,n,algoritmo,algoritmo_usado,execucoes,ns_mediana,ns_minimo,"
+                       "comparacoes,movimentos,bytes_movidos,ordenado\n");
+    }
+
+    for (int d = 0; d < TOTAL_DISTRIBUICOES; d++)
+    {
+        for (long long n = 10; n <= maximo; n *= 10)
+        {
+            gerarDistribuicao(original, (int)n, (DistribuicaoBenchmark)d, chaveInteira);
+
+            for (int a = 0; a < TOTAL_ALGORITMOS; a++)
+            {
+                if (n > LIMITE_QUADRATICO_BENCHMARK &&
+                    algoritmoQuadratico((AlgoritmoOrdenacao)a, original, (int)n, &base))
+                {
+                    continue;
+                }
+
+                medirDistribuicao((AlgoritmoOrdenacao)a, original, trabalho, (int)n, &base,
+                                  (DistribuicaoBenchmark)d, chave, saida, formatoJson, &medicoes);
+            }
+            fflush(saida);
+        }
+    }
+
+    if (formatoJson)
+    {
+        fprintf(saida, "\n  ]\n}\n");
+    }
+    fflush(saida);
+
+    free(trabalho);
+    free(original);
+    devolverArena();
+    return 1;
+}
+
+/*
+ * Função: telaBenchmark
+ * Descrição: pergunta os parâmetros e roda o benchmark pelo menu
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void telaBenchmark()
+{
+    printf("\n%s\n", LINHA);
+    printf("   ⏱️  BENCHMARK DE ORDENAÇÃO (DISTRIBUIÇÕES) ⏱️\n");
+    printf("%s\n", LINHA);
+
+    int maximo, chave, formato;
+    char arquivo[256];
+
+    printf("N máximo (10 a %d, ex: 1000000): ", MAXIMO_BENCHMARK);
+    scanf("%d", &maximo);
+    getchar();
+
+    if (maximo < 10 || maximo > MAXIMO_BENCHMARK)
+    {
+        printf("❌ Erro: N deve estar entre 10 e %d!\n", MAXIMO_BENCHMARK);
+        printf("%s\n\n", LINHA);
+        return;
+    }
 
-        switch (opcao)
-        {
-        case 1:
-            if (totalComponentes == 0)
-            {
-                printf("\n⚠️  Torre vazia!\n");
-                break;
-            }
+    printf("Chave (1 = texto, 2 = inteira): ");
+    scanf("%d", &chave);
+    getchar();
 
-            printf("\n%s\n", LINHA);
-            printf("     🔄 BUBBLE SORT - ORDENANDO POR NOME\n");
-            printf("%s\n", LINHA);
+    printf("Formato (1 = CSV, 2 = JSON): ");
+    scanf("%d", &formato);
+    getchar();
 
-            inicio = clock();
-            bubbleSortNome();
-            fim = clock();
-            tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    printf("Arquivo de saída (Enter = tela): ");
+    fgets(arquivo, sizeof(arquivo), stdin);
+    arquivo[strcspn(arquivo, "\n")] = 0;
 
-            printf("\n📊 DESEMPENHO DO BUBBLE SORT:\n");
-            printf("   Comparações: %d\n", comparacoesBubble);
-            printf("   Tempo: %.6f segundos\n", tempo);
-            printf("   Complexidade: O(n²)\n");
-            printf("%s\n", LINHA);
+    FILE *saida = stdout;
+    if (arquivo[0] != '\0')
+    {
+        saida = fopen(arquivo, "w");
+        if (saida == NULL)
+        {
+            printf("❌ Erro: não foi possível criar '%s'!\n", arquivo);
+            printf("%s\n\n", LINHA);
+            return;
+        }
+    }
 
-            listarComponentes();
-            break;
+    printf("\n⏳ Medindo (N = 10 até %d)...\n\n", maximo);
+    int concluiu = executarBenchmark(maximo, chave == 2, saida, formato == 2);
 
-        case 2:
-            if (totalComponentes == 0)
-            {
-                printf("\n⚠️  Torre vazia!\n");
-                break;
-            }
+    if (saida != stdout)
+    {
+        fclose(saida);
+        if (concluiu)
+        {
+            printf("✅ Resultados gravados em '%s'\n", arquivo);
+        }
+    }
 
-            printf("\n%s\n", LINHA);
-            printf("    🔄 INSERTION SORT - ORDENANDO POR TIPO\n");
-            printf("%s\n", LINHA);
+    if (!concluiu)
+    {
+        printf("❌ Erro: memória insuficiente para N = %d!\n", maximo);
+    }
+    printf("%s\n\n", LINHA);
+}
 
-            inicio = clock();
-            insertionSortTipo();
-            fim = clock();
-            tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+/* ========================================
+ * SNAPSHOT BINÁRIO DA TORRE
+ * ========================================
+ *
+ * Mesmo formato dos outros níveis: um CabecalhoSnapshot de 40 bytes, os
+ * nomes do dicionário de tipos (TAMANHO_TIPO bytes cada, completados
+ * com zeros até múltiplo de 8) e os registros Componente gravados como
+ * ficam na memória (sem lápides, com slot = ordem e prefixos já
+ * calculados). A torre é um vetor fixo de MAX_COMPONENTES, então não há
+ * o que mapear: os registros são lidos com um único fread e copiados
+ * direto para ela, sem interpretar texto. Só o que não vai para o
+ * arquivo é refeito na carga: mapa de slots e índices secundários (no
+ * máximo MAX_COMPONENTES inserções).
+ *
+ * Além dos campos do cabeçalho, cada registro é conferido antes de
+ * entrar na torre: prioridade fora de 1..10 quebraria o Counting Sort.
+ * O dicionário é refeito tipo a tipo na ordem do arquivo (os números
+ * gravados continuam valendo e as posições alfabéticas são
+ * recalculadas); nomes repetidos invalidam o arquivo. A versão 1 (tipo
+ * como texto no registro) não é mais lida.
+ */
 
-            printf("\n📊 DESEMPENHO DO INSERTION SORT:\n");
-            printf("   Comparações: %d\n", comparacoesInsertion);
-            printf("   Tempo: %.6f segundos\n", tempo);
-            printf("   Complexidade: O(n²)\n");
-            printf("%s\n", LINHA);
+#define ASSINATURA_SNAPSHOT "FFMESTRE"
+#define VERSAO_SNAPSHOT 2
+#define MARCA_ORDEM_BYTES 0x01020304u
 
-            listarComponentes();
-            break;
+typedef struct
+{
+    char assinatura[8];                // ASSINATURA_SNAPSHOT (sem '\0')
+    unsigned int versao;               // VERSAO_SNAPSHOT
+    unsigned int ordemBytes;           // MARCA_ORDEM_BYTES na ordem de quem gravou
+    unsigned int tamanhoRegistro;      // sizeof(Componente) de quem gravou
+    unsigned int reservado;            // zero
+    unsigned int totalTipos;           // nomes do dicionário logo após o cabeçalho
+    unsigned int tamanhoTipo;          // TAMANHO_TIPO de quem gravou
+    unsigned long long totalRegistros; // registros logo após o dicionário
+} CabecalhoSnapshot;
 
-        case 3:
-            if (totalComponentes == 0)
-            {
-                printf("\n⚠️  Torre vazia!\n");
-                break;
-            }
+const char *motivoSnapshot = ""; // Motivo da última falha de carga
 
-            printf("\n%s\n", LINHA);
-            printf("   🔄 SELECTION SORT - ORDENANDO POR PRIORIDADE\n");
-            printf("%s\n", LINHA);
+/*
+ * Função: bytesDoDicionario
+ * Descrição: calcula o espaço ocupado pelo dicionário no arquivo
+ * Parâmetros: número de tipos
+ * Retorno: bytes, arredondados para múltiplo de 8 (como nos outros níveis)
+ */
+size_t bytesDoDicionario(unsigned int tipos)
+{
+    return ((size_t)tipos * TAMANHO_TIPO + 7) / 8 * 8;
+}
 
-            inicio = clock();
-            selectionSortPrioridade();
-            fim = clock();
-            tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+/*
+ * Função: carregarSnapshot
+ * Descrição: monta a torre a partir de um snapshot
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se carregado, 0 se o arquivo não existe, -1 se inválido
+ *          (motivo em motivoSnapshot; a torre continua vazia)
+ *
+ * Deve ser chamada com a torre e o dicionário de tipos vazios, antes
+ * de qualquer operação.
+ */
+int carregarSnapshot(const char *caminho)
+{
+    CabecalhoSnapshot cabecalho;
+    Componente lidos[MAX_COMPONENTES];
+    char nomes[MAX_TIPOS * TAMANHO_TIPO + 8];
+    FILE *arquivo = fopen(caminho, "rb");
 
-            printf("\n📊 DESEMPENHO DO SELECTION SORT:\n");
-            printf("   Comparações: %d\n", comparacoesSelection);
-            printf("   Tempo: %.6f segundos\n", tempo);
-            printf("   Complexidade: O(n²)\n");
-            printf("%s\n", LINHA);
+    if (arquivo == NULL)
+    {
+        motivoSnapshot = strerror(errno);
+        return errno == ENOENT ? 0 : -1;
+    }
 
-            listarComponentes();
-            break;
+    size_t total = 0;
 
-        case 4:
+    if (fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1)
+    {
+        motivoSnapshot = "arquivo menor que o cabeçalho";
+    }
+    else if (memcmp(cabecalho.assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho.assinatura)) != 0)
+    {
+        motivoSnapshot = "não é um snapshot do nível mestre";
+    }
+    else if (cabecalho.ordemBytes != MARCA_ORDEM_BYTES)
+    {
+        motivoSnapshot = "gravado em uma máquina com outra ordem de bytes";
+    }
+    else if (cabecalho.versao != VERSAO_SNAPSHOT)
+    {
+        motivoSnapshot = "versão do formato não suportada";
+    }
+    else if (cabecalho.tamanhoRegistro != sizeof(Componente) || cabecalho.tamanhoTipo != TAMANHO_TIPO)
+    {
+        motivoSnapshot = "tamanho de registro diferente deste programa";
+    }
+    else if (cabecalho.totalTipos > MAX_TIPOS)
+    {
+        motivoSnapshot = "dicionário de tipos maior que o suportado";
+    }
+    else if (cabecalho.totalRegistros > MAX_COMPONENTES)
+    {
+        motivoSnapshot = "mais componentes do que a torre comporta";
+    }
+    else
+    {
+        size_t bytesTipos = bytesDoDicionario(cabecalho.totalTipos);
+        total = (size_t)cabecalho.totalRegistros;
+        if (fread(nomes, 1, bytesTipos, arquivo) != bytesTipos ||
+            fread(lidos, sizeof(Componente), total, arquivo) != total || fgetc(arquivo) != EOF)
         {
-            if (totalComponentes == 0)
-            {
-                printf("\n⚠️  Torre vazia!\n");
-                break;
-            }
+            motivoSnapshot = "tamanho do arquivo não confere com o cabeçalho";
+        }
+        else
+        {
+            motivoSnapshot = NULL;
+        }
+    }
+    fclose(arquivo);
 
-            printf("\n%s\n", LINHA);
-            printf("   📈 COMPARAÇÃO DOS 3 ALGORITMOS 📈\n");
-            printf("%s\n", LINHA);
+    for (unsigned int i = 0; motivoSnapshot == NULL && i < cabecalho.totalTipos; i++)
+    {
+        const char *nome = nomes + (size_t)i * TAMANHO_TIPO;
 
-            // Copia dados 3 vezes
-            Componente *copia1 = copiarComponentes(torre);
-            Componente *copia2 = copiarComponentes(torre);
-            Componente *copia3 = copiarComponentes(torre);
-
-            // Executa cada algoritmo
-            printf("\n⏳ Executando BUBBLE SORT...\n");
-            inicio = clock();
-            comparacoesBubble = 0;
-            int tempTrocas = 1;
-            for (int i = 0; i < totalComponentes - 1 && tempTrocas; i++)
-            {
-                tempTrocas = 0;
-                for (int j = 0; j < totalComponentes - i - 1; j++)
-                {
-                    comparacoesBubble++;
-                    if (strcmp(copia1[j].nome, copia1[j + 1].nome) > 0)
-                    {
-                        trocar(&copia1[j], &copia1[j + 1]);
-                        tempTrocas = 1;
-                    }
-                }
-            }
-            fim = clock();
-            double tempoBubble = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+        if (memchr(nome, '\0', TAMANHO_TIPO) == NULL || internarTipo(nome) != (int)i)
+        {
+            motivoSnapshot = "dicionário de tipos inválido";
+        }
+    }
 
-            printf("⏳ Executando INSERTION SORT...\n");
-            inicio = clock();
-            comparacoesInsertion = 0;
-            for (int i = 1; i < totalComponentes; i++)
-            {
-                Componente chave = copia2[i];
-                int j = i - 1;
-                while (j >= 0 && strcmp(copia2[j].tipo, chave.tipo) > 0)
-                {
-                    comparacoesInsertion++;
-                    copia2[j + 1] = copia2[j];
-                    j--;
-                }
-                if (j >= 0)
-                    comparacoesInsertion++;
-                copia2[j + 1] = chave;
-            }
-            fim = clock();
-            double tempoInsertion = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    for (size_t i = 0; motivoSnapshot == NULL && i < total; i++)
+    {
+        if (memchr(lidos[i].nome, '\0', sizeof(lidos[i].nome)) == NULL)
+        {
+            motivoSnapshot = "componente com texto sem terminador";
+        }
+        else if (lidos[i].tipo >= totalTipos)
+        {
+            motivoSnapshot = "componente com tipo fora do dicionário";
+        }
+        else if (lidos[i].prioridade < 1 || lidos[i].prioridade > 10 || lidos[i].quantidade <= 0)
+        {
+            motivoSnapshot = "componente com prioridade ou quantidade inválida";
+        }
+    }
 
-            printf("⏳ Executando SELECTION SORT...\n");
-            inicio = clock();
-            comparacoesSelection = 0;
-            for (int i = 0; i < totalComponentes - 1; i++)
-            {
-                int maiorIndice = i;
-                for (int j = i + 1; j < totalComponentes; j++)
-                {
-                    comparacoesSelection++;
-                    if (copia3[j].prioridade > copia3[maiorIndice].prioridade)
-                    {
-                        maiorIndice = j;
-                    }
-                }
-                if (maiorIndice != i)
-                {
-                    trocar(&copia3[i], &copia3[maiorIndice]);
-                }
-            }
-            fim = clock();
-            double tempoSelection = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    if (motivoSnapshot != NULL)
+    {
+        totalTipos = 0; // o dicionário volta a ficar vazio, como a torre
+        return -1;
+    }
 
-            // Exibe resultados
-            printf("\n%s\n", LINHA);
-            printf("   📊 RESULTADOS COMPARATIVOS\n");
-            printf("%s\n", LINHA);
+    memcpy(torre, lidos, total * sizeof(Componente));
 
-            printf("\n1️⃣  BUBBLE SORT (por Nome):\n");
-            printf("   Comparações: %d\n", comparacoesBubble);
-            printf("   Tempo: %.6f segundos\n", tempoBubble);
+    for (size_t i = 0; i < total; i++)
+    {
+        Componente *componente = &torre[posicoesTorre];
 
-            printf("\n2️⃣  INSERTION SORT (por Tipo):\n");
-            printf("   Comparações: %d\n", comparacoesInsertion);
-            printf("   Tempo: %.6f segundos\n", tempoInsertion);
+        // Prefixos dependem só do texto: recalcular protege contra
+        // registros gravados por outra compilação
+        componente->removido = 0;
+        componente->prefixoNome = prefixoTexto(componente->nome);
 
-            printf("\n3️⃣  SELECTION SORT (por Prioridade):\n");
-            printf("   Comparações: %d\n", comparacoesSelection);
-            printf("   Tempo: %.6f segundos\n", tempoSelection);
+        Handle handle = alocarSlot(posicoesTorre);
+        componente->slot = handle.slot;
+        posicoesTorre++;
+        totalComponentes++;
+        inserirNosIndices(handle.slot);
+    }
+    return 1;
+}
 
-            printf("\n%s\n", LINHA);
-            printf("   💡 ANÁLISE\n");
-            printf("%s\n", LINHA);
+/*
+ * Função: salvarSnapshot
+ * Descrição: grava os componentes ativos da torre no formato de snapshot
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se sucesso, 0 se não foi possível gravar
+ *
+ * Grava em "caminho.tmp" e renomeia depois de forçar os dados para o
+ * disco, para que uma queda no meio deixe o snapshot anterior intacto.
+ */
+int salvarSnapshot(const char *caminho)
+{
+    char temporario[FILENAME_MAX];
+    Componente registros[MAX_COMPONENTES];
+    int total = 0;
 
-            if (totalComponentes <= 5)
-            {
-                printf("\nPara %d componentes:\n", totalComponentes);
-                printf("✓ Todos os algoritmos são RÁPIDOS\n");
-                printf("✓ Diferenças de tempo são negligenciáveis\n");
-            }
-            else
-            {
-                printf("\nPara %d componentes:\n", totalComponentes);
+    if (snprintf(temporario, sizeof(temporario), "%s.tmp", caminho) >= (int)sizeof(temporario))
+    {
+        return 0;
+    }
 
-                if (comparacoesBubble > comparacoesInsertion)
-                {
-                    printf("🏆 INSERTION SORT é mais eficiente que Bubble Sort\n");
-                    printf("   Economia: %d comparações\n", comparacoesBubble - comparacoesInsertion);
-                }
+    // Registros zerados (inclusive o preenchimento): arquivo determinístico
+    memset(registros, 0, sizeof(registros));
+    for (int i = 0; i < posicoesTorre; i++)
+    {
+        if (torre[i].removido)
+        {
+            continue;
+        }
 
-                if (comparacoesSelection < comparacoesBubble)
-                {
-                    printf("🏆 SELECTION SORT é competitivo\n");
-                }
-            }
+        Componente *registro = &registros[total];
+        memcpy(registro->nome, torre[i].nome, strlen(torre[i].nome));
+        registro->tipo = torre[i].tipo;
+        registro->prioridade = torre[i].prioridade;
+        registro->quantidade = torre[i].quantidade;
+        registro->slot = total;
+        registro->prefixoNome = torre[i].prefixoNome;
+        total++;
+    }
 
-            printf("\n📌 CONCLUSÃO EDUCACIONAL:\n");
-            printf("✓ O(n²) é aceitável para dados pequenos (<100)\n");
-            printf("✓ Para dados maiores, use O(n log n) (Quick/Merge/Heap Sort)\n");
-            printf("✓ Insertion Sort: melhor para dados quase ordenados\n");
-            printf("✓ Selection Sort: número fixo de iterações\n");
+    CabecalhoSnapshot cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho.assinatura));
+    cabecalho.versao = VERSAO_SNAPSHOT;
+    cabecalho.ordemBytes = MARCA_ORDEM_BYTES;
+    cabecalho.tamanhoRegistro = sizeof(Componente);
+    cabecalho.totalTipos = (unsigned int)totalTipos;
+    cabecalho.tamanhoTipo = TAMANHO_TIPO;
+    cabecalho.totalRegistros = (unsigned long long)total;
 
-            printf("%s\n", LINHA);
+    static const char zeros[8];
+    size_t bytesTipos = (size_t)totalTipos * TAMANHO_TIPO;
+    size_t preenchimento = bytesDoDicionario((unsigned int)totalTipos) - bytesTipos;
 
-            free(copia1);
-            free(copia2);
-            free(copia3);
-            break;
-        }
+    FILE *arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL)
+    {
+        return 0;
+    }
 
-        case 5:
-            return;
+    int sucesso = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 &&
+                  fwrite(nomesTipos, 1, bytesTipos, arquivo) == bytesTipos &&
+                  fwrite(zeros, 1, preenchimento, arquivo) == preenchimento &&
+                  fwrite(registros, sizeof(Componente), (size_t)total, arquivo) == (size_t)total &&
+                  fflush(arquivo) == 0;
+#ifndef _WIN32
+    sucesso = sucesso && fsync(fileno(arquivo)) == 0;
+#endif
+    if (fclose(arquivo) != 0)
+    {
+        sucesso = 0;
+    }
 
-        default:
-            printf("❌ Opção inválida!\n");
-        }
+#ifdef _WIN32
+    if (sucesso)
+    {
+        remove(caminho); // rename não substitui arquivos no Windows
     }
+#endif
+
+    if (!sucesso || rename(temporario, caminho) != 0)
+    {
+        remove(temporario);
+        return 0;
+    }
+    return 1;
 }
 
 /* ========================================
@@ -773,9 +4216,11 @@ int menuPrincipal()
     printf("  3️⃣  - Listar componentes\n");
     printf("  4️⃣  - Ordenar componentes\n");
     printf("  5️⃣  - Buscar componente-chave (binária)\n");
-    printf("  6️⃣  - Sair do jogo\n");
+    printf("  6️⃣  - Usar componente (por handle)\n");
+    printf("  7️⃣  - Benchmark de ordenação (distribuições)\n");
+    printf("  8️⃣  - Sair do jogo\n");
     printf("%s\n", LINHA);
-    printf("Digite sua opção (1-6): ");
+    printf("Digite sua opção (1-8): ");
 
     int opcao;
     scanf("%d", &opcao);
@@ -788,14 +4233,110 @@ int menuPrincipal()
  * FUNÇÃO PRINCIPAL
  * ======================================== */
 
-int main()
+int main(int argc, char *argv[])
 {
+    int modoBenchmark = 0;
+    int formatoJson = 0;
+    int chaveInteira = 0;
+    long long maximoBenchmark = 1000000;
+    const char *arquivoSaida = NULL;
+    const char *arquivoSnapshot = NULL;
+
+    threadsOrdenacao = contarNucleos();
+
+    // Interpreta os argumentos da linha de comando
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--benchmark") == 0)
+        {
+            modoBenchmark = 1;
+        }
+        else if (strcmp(argv[i], "--max") == 0 && i + 1 < argc)
+        {
+            maximoBenchmark = atoll(argv[++i]);
+            if (maximoBenchmark < 10 || maximoBenchmark > MAXIMO_BENCHMARK)
+            {
+                fprintf(stderr, "Erro: --max deve estar entre 10 e %d\n", MAXIMO_BENCHMARK);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--chave") == 0 && i + 1 < argc &&
+                 (strcmp(argv[i + 1], "texto") == 0 || strcmp(argv[i + 1], "inteira") == 0))
+        {
+            chaveInteira = strcmp(argv[++i], "inteira") == 0;
+        }
+        else if (strcmp(argv[i], "--json") == 0)
+        {
+            formatoJson = 1;
+        }
+        else if (strcmp(argv[i], "--saida") == 0 && i + 1 < argc)
+        {
+            arquivoSaida = argv[++i];
+        }
+        else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+        {
+            arquivoSnapshot = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr,
+                    "Uso: %s [--snapshot arquivo] [--benchmark [--max N] [--chave texto|inteira] [--json] [--saida arquivo]]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    // Modo benchmark: só a saída CSV/JSON, sem menus
+    if (modoBenchmark)
+    {
+        FILE *saida = stdout;
+
+        if (arquivoSaida != NULL)
+        {
+            saida = fopen(arquivoSaida, "w");
+            if (saida == NULL)
+            {
+                fprintf(stderr, "Erro: não foi possível criar '%s'\n", arquivoSaida);
+                return 1;
+            }
+        }
+
+        int concluiu = executarBenchmark((int)maximoBenchmark, chaveInteira, saida, formatoJson);
+
+        if (saida != stdout)
+        {
+            fclose(saida);
+        }
+
+        if (!concluiu)
+        {
+            fprintf(stderr, "Erro: memória insuficiente para N = %lld\n", maximoBenchmark);
+            return 1;
+        }
+        return 0;
+    }
+
     printf("\n╔════════════════════════════════════════════════════╗\n");
     printf("║      BEM-VINDO AO FREE FIRE - NÍVEL MESTRE 🏆    ║\n");
     printf("║  Construa a torre de fuga com os componentes!     ║\n");
     printf("║  Escolha a estratégia certa para sobreviver!      ║\n");
     printf("╚════════════════════════════════════════════════════╝\n");
 
+    if (arquivoSnapshot != NULL)
+    {
+        int carregado = carregarSnapshot(arquivoSnapshot);
+
+        if (carregado == -1)
+        {
+            fprintf(stderr, "Erro: snapshot '%s' inválido: %s\n", arquivoSnapshot, motivoSnapshot);
+            return 1;
+        }
+        if (carregado == 1)
+        {
+            printf("\n📂 Snapshot '%s' carregado: %d componentes na torre.\n", arquivoSnapshot, totalComponentes);
+        }
+    }
+
     int opcao;
 
     while (1)
@@ -825,13 +4366,30 @@ int main()
             break;
 
         case 6:
+            usarComponente();
+            break;
+
+        case 7:
+            telaBenchmark();
+            break;
+
+        case 8:
+            if (arquivoSnapshot != NULL)
+            {
+                if (!salvarSnapshot(arquivoSnapshot))
+                {
+                    printf("\n❌ Erro: não foi possível gravar o snapshot '%s'.\n", arquivoSnapshot);
+                    break;
+                }
+                printf("\n💾 Torre gravada em '%s' (%d componentes).\n", arquivoSnapshot, totalComponentes);
+            }
             printf("\n╔════════════════════════════════════════════════════╗\n");
             printf("║    👋 OBRIGADO POR JOGAR! VOCÊ ESCAPOU! 🚀👋       ║\n");
             printf("╚════════════════════════════════════════════════════╝\n\n");
             return 0;
 
         default:
-            printf("\n❌ Opção inválida! Digite um número entre 1 e 6.\n");
+            printf("\n❌ Opção inválida! Digite um número entre 1 e 8.\n");
         }
     }
 
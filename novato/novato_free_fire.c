@@ -8,54 +8,2142 @@
  * permitindo que o jogador gerencie seus itens coletados durante a partida.
  *
  * Funcionalidades:
- * - Cadastro de itens (máx 10 itens)
+ * - Cadastro de itens (mochila cresce conforme a necessidade)
  * - Remoção de itens
- * - Listagem de todos os itens
- * - Busca sequencial por nome
+ * - Listagem paginada de todos os itens
+ * - Busca por nome em tempo constante (índice hash com endereçamento aberto)
+ * - Dicionário de tipos: cada item guarda só o número do seu tipo
+ * - Handles geracionais: acesso O(1) a um item sem buscar pelo nome
+ * - Modo roteiro (sem interface) para processar comandos em lote
+ * - Snapshot binário: a mochila é gravada em registros de tamanho fixo
+ *   e, na abertura, o arquivo é mapeado e usado direto como vetor
+ * - Diário de operações: cada mudança vira um registro no fim de um
+ *   arquivo (fsync em grupo), reaplicado na abertura após uma queda e
+ *   compactado periodicamente no snapshot
+ *
+ * Modo roteiro:
+ *   novato_free_fire --roteiro [arquivo]
+ *   Lê comandos do arquivo (ou da entrada padrão, se omitido ou "-"),
+ *   um por linha, com campos separados por '|':
+ *     adicionar|nome|tipo|quantidade
+ *     remover|nome
+ *     buscar|nome       -> imprime "nome|tipo|quantidade" ou "nao encontrado|nome"
+ *     listar[|ini|lim]  -> imprime uma linha "nome|tipo|quantidade" por item
+ *                          (opcionalmente a partir do item ini, até lim itens)
+ *     tipo|nome         -> como listar, só os itens desse tipo
+ *     handle|nome       -> imprime o handle do item ("slot:geracao")
+ *     ler|handle        -> imprime "nome|tipo|quantidade" ou "handle invalido|handle"
+ *     consumir|handle|n -> retira n unidades (o item sai ao chegar a zero)
+ *     descartar|handle  -> remove o item do handle
+ *   Linhas vazias ou iniciadas por '#' são ignoradas. Apenas as
+ *   consultas produzem saída; erros vão para stderr com o número da linha.
+ *
+ * Opções:
+ *   --reserva N   capacidade inicial da mochila (padrão: 10 itens)
+ *   --remocao M   "lapide" (padrão) marca o item como removido e compacta
+ *                 depois; "deslocamento" desloca os itens a cada remoção
+ *   --snapshot A  carrega a mochila do arquivo A (se existir) e, se algo
+ *                 mudou, grava o estado final nele ao sair (menu ou fim
+ *                 do roteiro)
+ *   --diario      (exige --snapshot) registra cada mudança em "A.diario"
+ *                 assim que acontece, em vez de só ao sair
+ *   --grupo N     registros do diário por fsync (padrão: 32; 1 = cada
+ *                 operação vai para o disco antes de continuar)
  *
  * Autor: Estrutura de Dados - Nível Novato
  * Data: 2026
  */
 
-#include <stdio.h>
-#include <string.h>
-#include <stdlib.h>
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // fsync, fileno
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <limits.h>
+
+#ifdef _WIN32
+#include <io.h> // _commit
+#else
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close, fsync, write
+#endif
+
+/* ========================================
+ * DEFINIÇÃO DA STRUCT
+ * ========================================
+ *
+ * Struct Item: armazena informações sobre um item do inventário
+ * - nome: identificação do item (ex: "Rifle AK")
+ * - tipo: categoria do item (ex: "arma", "munição", "cura"), guardada
+ *   como o número do tipo na seção DICIONÁRIO DE TIPOS
+ * - quantidade: número de unidades desse item
+ * - removido: 1 se a posição é uma lápide (item apagado, aguardando compactação)
+ * - slot: entrada do mapa de slots que aponta para este item
+ */
+typedef struct
+{
+    char nome[30];
+    unsigned char tipo;
+    int quantidade;
+    char removido;
+    int slot;
+} Item;
+
+/*
+ * Struct Handle: referência estável para um item
+ * - slot: entrada no mapa de slots
+ * - geracao: versão do slot quando o handle foi emitido; se o item for
+ *   removido, o slot muda de geração e o handle antigo deixa de valer
+ */
+typedef struct
+{
+    int slot;
+    unsigned int geracao;
+} Handle;
+
+/* ========================================
+ * CONSTANTES E VARIÁVEIS GLOBAIS
+ * ======================================== */
+#define CAPACIDADE_INICIAL 10
+#define LINHA "=================================================="
+
+#define FRACAO_MAXIMA_LAPIDES 4 // Compacta quando mais de 1/4 das posições são lápides
+
+// Estratégia de remoção
+typedef enum
+{
+    REMOCAO_DESLOCAMENTO, // desloca os itens seguintes (O(n) por remoção)
+    REMOCAO_LAPIDE        // marca a posição e compacta depois (O(1) amortizado)
+} ModoRemocao;
+
+// Mudanças gravadas no diário de operações
+typedef enum
+{
+    DIARIO_ADICIONAR = 1, // item novo no fim da mochila
+    DIARIO_REMOVER,       // item sai (remoção, descarte ou consumo total)
+    DIARIO_QUANTIDADE     // item passa a ter outra quantidade
+} OperacaoDiario;
+
+Item *mochila = NULL;                        // Vetor dinâmico de itens
+int totalItens = 0;                          // Contador de itens atualmente na mochila
+int posicoesOcupadas = 0;                    // Posições usadas em mochila (itens + lápides)
+int totalLapides = 0;                        // Posições marcadas como removidas
+int capacidadeMochila = 0;                   // Posições alocadas em mochila
+int reservaInicial = CAPACIDADE_INICIAL;     // Capacidade mínima mantida após encolher
+ModoRemocao modoRemocao = REMOCAO_LAPIDE;    // Estratégia usada por removerItemMochila
+int estruturasPendentes = 0;                 // 1: índice e slots ainda não montados após um snapshot
+int mochilaAlterada = 0;                     // 1: houve mudança desde o início (snapshot a gravar)
+
+int prepararEstruturas();                                                    // Seção SNAPSHOT BINÁRIO
+void registrarNoDiario(OperacaoDiario operacao, int posicao, int quantidade); // Seção DIÁRIO DE OPERAÇÕES
+
+/* ========================================
+ * ÍNDICE HASH POR NOME
+ * ========================================
+ *
+ * Tabela com endereçamento aberto (sondagem linear) que guarda, para
+ * cada item, o hash do nome e sua posição na mochila. A capacidade é
+ * sempre potência de 2 e a ocupação fica abaixo de 50%, então busca,
+ * inserção e remoção custam O(1) esperado.
+ *
+ * Remoções usam deslocamento para trás (backward shift), de modo que a
+ * tabela nunca acumula lápides. Nomes repetidos são permitidos: a busca
+ * devolve a menor posição, igual à busca sequencial original.
+ */
+
+#define CAPACIDADE_MINIMA_INDICE 16
+#define POSICAO_VAZIA -1
+
+typedef struct
+{
+    unsigned int hash; // hash do nome (evita strcmp em colisões)
+    int posicao;       // posição do item na mochila ou POSICAO_VAZIA
+} EntradaIndice;
+
+EntradaIndice *indiceNomes = NULL; // Tabela hash
+int capacidadeIndice = 0;          // Sempre potência de 2
+int ocupadosIndice = 0;            // Entradas em uso
+int sondagensHash = 0;             // Posições visitadas na última busca
+
+/*
+ * Função: hashNome
+ * Descrição: calcula o hash FNV-1a de 32 bits de um nome
+ * Parâmetros: nome
+ * Retorno: hash do nome
+ */
+unsigned int hashNome(const char *nome)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*nome)
+    {
+        hash ^= (unsigned char)*nome++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+ * Função: inserirNaTabela
+ * Descrição: grava uma entrada na tabela (que deve ter espaço livre)
+ * Parâmetros: tabela, capacidade, hash e posição do item
+ * Retorno: nenhum
+ */
+void inserirNaTabela(EntradaIndice *tabela, int capacidade, unsigned int hash, int posicao)
+{
+    int mascara = capacidade - 1;
+    int i = (int)(hash & (unsigned int)mascara);
+
+    while (tabela[i].posicao != POSICAO_VAZIA)
+    {
+        i = (i + 1) & mascara;
+    }
+
+    tabela[i].hash = hash;
+    tabela[i].posicao = posicao;
+}
+
+/*
+ * Função: preencherTabela
+ * Descrição: esvazia a tabela e indexa todos os itens da mochila
+ * Parâmetros: tabela e sua capacidade (potência de 2, maior que 2 * totalItens)
+ * Retorno: nenhum
+ *
+ * Lápides não entram no índice.
+ */
+void preencherTabela(EntradaIndice *tabela, int capacidade)
+{
+    for (int i = 0; i < capacidade; i++)
+    {
+        tabela[i].posicao = POSICAO_VAZIA;
+    }
+
+    for (int i = 0; i < posicoesOcupadas; i++)
+    {
+        if (!mochila[i].removido)
+        {
+            inserirNaTabela(tabela, capacidade, hashNome(mochila[i].nome), i);
+        }
+    }
+}
+
+/*
+ * Função: reconstruirIndice
+ * Descrição: recria a tabela com a capacidade pedida a partir da mochila
+ * Parâmetros: nova capacidade (potência de 2, maior que 2 * totalItens)
+ * Retorno: 1 se sucesso, 0 se faltou memória (tabela antiga é mantida)
+ */
+int reconstruirIndice(int novaCapacidade)
+{
+    EntradaIndice *novaTabela = (EntradaIndice *)malloc((size_t)novaCapacidade * sizeof(EntradaIndice));
+
+    if (novaTabela == NULL)
+    {
+        return 0;
+    }
+
+    preencherTabela(novaTabela, novaCapacidade);
+
+    free(indiceNomes);
+    indiceNomes = novaTabela;
+    capacidadeIndice = novaCapacidade;
+    ocupadosIndice = totalItens;
+    return 1;
+}
+
+/*
+ * Função: garantirEspacoIndice
+ * Descrição: dobra a tabela se mais uma entrada passar de 50% de ocupação
+ * Parâmetros: nenhum
+ * Retorno: 1 se há espaço, 0 se faltou memória
+ */
+int garantirEspacoIndice()
+{
+    if ((ocupadosIndice + 1) * 2 <= capacidadeIndice)
+    {
+        return 1;
+    }
+
+    int novaCapacidade = capacidadeIndice > 0 ? capacidadeIndice * 2 : CAPACIDADE_MINIMA_INDICE;
+    return reconstruirIndice(novaCapacidade);
+}
+
+/*
+ * Função: indexarItem
+ * Descrição: adiciona ao índice o item de uma posição da mochila
+ * Parâmetros: posição do item (o espaço já deve estar garantido)
+ * Retorno: nenhum
+ */
+void indexarItem(int posicao)
+{
+    inserirNaTabela(indiceNomes, capacidadeIndice, hashNome(mochila[posicao].nome), posicao);
+    ocupadosIndice++;
+}
+
+/*
+ * Função: buscarNoIndice
+ * Descrição: procura um nome na tabela hash, contando as sondagens
+ * Parâmetros: nome do item
+ * Retorno: menor posição com esse nome ou -1 se não encontrado
+ */
+int buscarNoIndice(const char *nome)
+{
+    sondagensHash = 0;
+
+    if (capacidadeIndice == 0)
+    {
+        return -1;
+    }
+
+    unsigned int hash = hashNome(nome);
+    int mascara = capacidadeIndice - 1;
+    int i = (int)(hash & (unsigned int)mascara);
+    int encontrado = -1;
+
+    // Percorre o agrupamento inteiro: pode haver nomes repetidos
+    while (indiceNomes[i].posicao != POSICAO_VAZIA)
+    {
+        sondagensHash++;
+
+        int posicao = indiceNomes[i].posicao;
+        if (indiceNomes[i].hash == hash &&
+            (encontrado == -1 || posicao < encontrado) &&
+            strcmp(mochila[posicao].nome, nome) == 0)
+        {
+            encontrado = posicao;
+        }
+        i = (i + 1) & mascara;
+    }
+
+    sondagensHash++; // posição vazia que encerrou a busca
+    return encontrado;
+}
+
+/*
+ * Função: ocorrenciaNoIndice
+ * Descrição: conta quantos itens com o mesmo nome vêm antes de uma posição
+ * Parâmetros: posição de um item ativo
+ * Retorno: 0 se é o primeiro item com esse nome, 1 se é o segundo...
+ *
+ * Junto com o nome, identifica o item sem depender de posições ou
+ * slots, que mudam com compactações e snapshots. Custa o mesmo que
+ * uma busca: só o agrupamento do hash é percorrido.
+ */
+int ocorrenciaNoIndice(int posicao)
+{
+    const char *nome = mochila[posicao].nome;
+    unsigned int hash = hashNome(nome);
+    int mascara = capacidadeIndice - 1;
+    int ocorrencia = 0;
+
+    for (int i = (int)(hash & (unsigned int)mascara); indiceNomes[i].posicao != POSICAO_VAZIA; i = (i + 1) & mascara)
+    {
+        int outra = indiceNomes[i].posicao;
+        if (indiceNomes[i].hash == hash && outra < posicao && strcmp(mochila[outra].nome, nome) == 0)
+        {
+            ocorrencia++;
+        }
+    }
+
+    return ocorrencia;
+}
+
+/*
+ * Função: posicaoDaOcorrencia
+ * Descrição: inverso de ocorrenciaNoIndice
+ * Parâmetros: nome, ocorrência (0 = primeiro item com esse nome)
+ * Retorno: posição do item ou -1 se não existir
+ */
+int posicaoDaOcorrencia(const char *nome, int ocorrencia)
+{
+    if (capacidadeIndice == 0 || ocorrencia < 0)
+    {
+        return -1;
+    }
+
+    unsigned int hash = hashNome(nome);
+    int mascara = capacidadeIndice - 1;
+    int anterior = -1;
+
+    // A cada volta, a menor posição com esse nome depois da anterior
+    for (int k = 0; k <= ocorrencia; k++)
+    {
+        int proxima = -1;
+
+        for (int i = (int)(hash & (unsigned int)mascara); indiceNomes[i].posicao != POSICAO_VAZIA; i = (i + 1) & mascara)
+        {
+            int posicao = indiceNomes[i].posicao;
+            if (indiceNomes[i].hash == hash && posicao > anterior && (proxima == -1 || posicao < proxima) &&
+                strcmp(mochila[posicao].nome, nome) == 0)
+            {
+                proxima = posicao;
+            }
+        }
+
+        if (proxima == -1)
+        {
+            return -1;
+        }
+        anterior = proxima;
+    }
+
+    return anterior;
+}
+
+/*
+ * Função: desindexarItem
+ * Descrição: retira do índice a entrada de uma posição da mochila
+ * Parâmetros: posição do item (ainda presente na mochila)
+ * Retorno: nenhum
+ *
+ * Usa deslocamento para trás: as entradas seguintes do agrupamento que
+ * pertencem a posições anteriores ao buraco são puxadas para ele.
+ */
+void desindexarItem(int posicao)
+{
+    int mascara = capacidadeIndice - 1;
+    int i = (int)(hashNome(mochila[posicao].nome) & (unsigned int)mascara);
+
+    while (indiceNomes[i].posicao != posicao)
+    {
+        i = (i + 1) & mascara;
+    }
+
+    int buraco = i;
+    int j = (buraco + 1) & mascara;
+
+    while (indiceNomes[j].posicao != POSICAO_VAZIA)
+    {
+        int ideal = (int)(indiceNomes[j].hash & (unsigned int)mascara);
+
+        // A entrada pode ir para o buraco se o ideal dela não estiver
+        // no trecho circular (buraco, j]
+        if (((j - ideal) & mascara) >= ((j - buraco) & mascara))
+        {
+            indiceNomes[buraco] = indiceNomes[j];
+            buraco = j;
+        }
+        j = (j + 1) & mascara;
+    }
+
+    indiceNomes[buraco].posicao = POSICAO_VAZIA;
+    ocupadosIndice--;
+}
+
+/*
+ * Função: ajustarPosicoesIndice
+ * Descrição: corrige o índice após um deslocamento da mochila
+ * Parâmetros: posição removida (entradas acima dela descem uma posição)
+ * Retorno: nenhum
+ */
+void ajustarPosicoesIndice(int posicaoRemovida)
+{
+    for (int i = 0; i < capacidadeIndice; i++)
+    {
+        if (indiceNomes[i].posicao > posicaoRemovida)
+        {
+            indiceNomes[i].posicao--;
+        }
+    }
+}
+
+/*
+ * Função: encolherIndice
+ * Descrição: reduz a tabela à metade quando fica com menos de 1/8 ocupado
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void encolherIndice()
+{
+    if (capacidadeIndice <= CAPACIDADE_MINIMA_INDICE || ocupadosIndice * 8 >= capacidadeIndice)
+    {
+        return;
+    }
+
+    // Se faltar memória, a tabela maior continua válida
+    reconstruirIndice(capacidadeIndice / 2);
+}
+
+/*
+ * Função: liberarIndice
+ * Descrição: libera a memória da tabela hash
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void liberarIndice()
+{
+    free(indiceNomes);
+    indiceNomes = NULL;
+    capacidadeIndice = 0;
+    ocupadosIndice = 0;
+}
+
+/* ========================================
+ * MAPA DE SLOTS (HANDLES GERACIONAIS)
+ * ========================================
+ *
+ * Cada item recebe um slot que guarda sua posição atual na mochila.
+ * Quando itens se movem (deslocamento ou compactação), só o campo
+ * posicao do slot muda; o handle entregue ao jogador continua válido.
+ * Slots livres formam uma lista encadeada e são reaproveitados com a
+ * geração incrementada, o que invalida handles antigos em O(1).
+ */
+
+#define SLOT_LIVRE -1
+
+typedef struct
+{
+    int posicao;          // posição do item na mochila ou SLOT_LIVRE
+    unsigned int geracao; // incrementada cada vez que o slot é liberado
+    int proximoLivre;     // próximo slot da lista de livres
+} SlotItem;
+
+SlotItem *slots = NULL;     // Mapa de slots
+int totalSlots = 0;         // Slots já criados (livres ou em uso)
+int capacidadeSlots = 0;    // Slots alocados
+int primeiroSlotLivre = -1; // Início da lista de slots livres
+
+/*
+ * Função: alocarSlot
+ * Descrição: reserva um slot apontando para uma posição da mochila
+ * Parâmetros: posição do item, handle de saída
+ * Retorno: 1 se sucesso, 0 se faltou memória
+ */
+int alocarSlot(int posicao, Handle *handle)
+{
+    int slot = primeiroSlotLivre;
+
+    if (slot != -1)
+    {
+        primeiroSlotLivre = slots[slot].proximoLivre;
+    }
+    else
+    {
+        if (totalSlots == capacidadeSlots)
+        {
+            int novaCapacidade = capacidadeSlots > 0 ? capacidadeSlots * 2 : CAPACIDADE_INICIAL;
+            SlotItem *novosSlots = (SlotItem *)realloc(slots, (size_t)novaCapacidade * sizeof(SlotItem));
+
+            if (novosSlots == NULL)
+            {
+                return 0;
+            }
+            slots = novosSlots;
+            capacidadeSlots = novaCapacidade;
+        }
+
+        slot = totalSlots++;
+        slots[slot].geracao = 1;
+    }
+
+    slots[slot].posicao = posicao;
+    handle->slot = slot;
+    handle->geracao = slots[slot].geracao;
+    return 1;
+}
+
+/*
+ * Função: liberarSlot
+ * Descrição: devolve um slot à lista de livres, invalidando seus handles
+ * Parâmetros: slot
+ * Retorno: nenhum
+ */
+void liberarSlot(int slot)
+{
+    slots[slot].posicao = SLOT_LIVRE;
+    slots[slot].geracao++;
+    slots[slot].proximoLivre = primeiroSlotLivre;
+    primeiroSlotLivre = slot;
+}
+
+/*
+ * Função: resolverHandle
+ * Descrição: converte um handle na posição atual do item
+ * Parâmetros: handle
+ * Retorno: posição na mochila ou -1 se o handle não é (mais) válido
+ */
+int resolverHandle(Handle handle)
+{
+    if (!prepararEstruturas() || handle.slot < 0 || handle.slot >= totalSlots)
+    {
+        return -1;
+    }
+
+    SlotItem *slot = &slots[handle.slot];
+    if (slot->posicao == SLOT_LIVRE || slot->geracao != handle.geracao)
+    {
+        return -1;
+    }
+
+    return slot->posicao;
+}
+
+/*
+ * Função: lerHandle
+ * Descrição: interpreta um handle no formato "slot:geracao"
+ * Parâmetros: texto, handle de saída
+ * Retorno: 1 se o texto é válido, 0 caso contrário
+ */
+int lerHandle(const char *texto, Handle *handle)
+{
+    char resto;
+    return sscanf(texto, "%d:%u%c", &handle->slot, &handle->geracao, &resto) == 2;
+}
+
+/*
+ * Função: liberarSlots
+ * Descrição: libera a memória do mapa de slots
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void liberarSlots()
+{
+    free(slots);
+    slots = NULL;
+    totalSlots = 0;
+    capacidadeSlots = 0;
+    primeiroSlotLivre = -1;
+}
+
+/* ========================================
+ * DICIONÁRIO DE TIPOS
+ * ========================================
+ *
+ * Os itens repetem poucos tipos (arma, munição, cura...), então cada
+ * nome de tipo é guardado uma única vez aqui e o item guarda só o seu
+ * número: 1 byte em vez de 20, e filtrar por tipo é comparar inteiros.
+ * Os números seguem a ordem em que os tipos aparecem e nunca mudam.
+ * Tipos não são apagados: o dicionário só cresce, até MAX_TIPOS.
+ */
+
+#define MAX_TIPOS 256   // números de tipo cabem em um unsigned char
+#define TAMANHO_TIPO 20 // maior nome de tipo, com o '\0'
+
+char nomesTipos[MAX_TIPOS][TAMANHO_TIPO]; // Nome de cada tipo, pelo número
+int totalTipos = 0;                       // Tipos já criados
+
+/*
+ * Função: procurarTipo
+ * Descrição: procura um tipo no dicionário sem criá-lo
+ * Parâmetros: nome do tipo (truncado como ao guardar)
+ * Retorno: número do tipo ou -1 se não existe
+ */
+int procurarTipo(const char *tipo)
+{
+    char nome[TAMANHO_TIPO];
+    snprintf(nome, sizeof(nome), "%s", tipo);
+
+    for (int i = 0; i < totalTipos; i++)
+    {
+        if (strcmp(nomesTipos[i], nome) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Função: internarTipo
+ * Descrição: devolve o número de um tipo, criando-o se for novo
+ * Parâmetros: nome do tipo (truncado em TAMANHO_TIPO - 1 caracteres)
+ * Retorno: número do tipo ou -1 se o dicionário está cheio
+ */
+int internarTipo(const char *tipo)
+{
+    int numero = procurarTipo(tipo);
+
+    if (numero == -1 && totalTipos < MAX_TIPOS)
+    {
+        // Resto zerado: o dicionário vai para o snapshot como está
+        numero = totalTipos++;
+        memset(nomesTipos[numero], 0, TAMANHO_TIPO);
+        memcpy(nomesTipos[numero], tipo, strnlen(tipo, TAMANHO_TIPO - 1));
+    }
+    return numero;
+}
+
+/*
+ * Função: nomeDoTipo
+ * Descrição: converte o número de um tipo no seu nome
+ * Parâmetros: número do tipo
+ * Retorno: nome do tipo ("?" se o número não existe no dicionário)
+ */
+const char *nomeDoTipo(int numero)
+{
+    return numero >= 0 && numero < totalTipos ? nomesTipos[numero] : "?";
+}
+
+/* ========================================
+ * SNAPSHOT BINÁRIO
+ * ========================================
+ *
+ * Formato: um CabecalhoSnapshot de 40 bytes, os totalTipos nomes do
+ * dicionário de tipos (TAMANHO_TIPO bytes cada, completados com zeros
+ * até múltiplo de 8) e totalRegistros registros Item gravados
+ * exatamente como ficam na memória (sem lápides, com slot = ordem do
+ * item e tipo = número no dicionário gravado). Como não há texto para
+ * interpretar, a carga mapeia o arquivo (mmap com MAP_PRIVATE) e usa
+ * os registros no lugar como vetor da mochila: abrir um inventário de
+ * milhões de itens custa o mesmo que abrir um vazio. Alterações ficam
+ * só na memória (cópia na escrita) e o arquivo só muda ao salvar.
+ *
+ * O índice hash e o mapa de slots não são gravados: são montados na
+ * primeira operação que precisa deles (prepararEstruturas). Listar
+ * logo após carregar não paga esse custo. Na primeira mudança de
+ * tamanho a mochila passa para o heap e o mapeamento é desfeito.
+ *
+ * O arquivo só é aceito se assinatura, versão, ordem dos bytes e
+ * tamanhos do registro e do tipo baterem com este programa. A versão
+ * 1 (tipo como texto dentro do registro) não é mais lida. No Windows
+ * (sem mmap) os registros são lidos com um único fread.
+ */
+
+#define ASSINATURA_SNAPSHOT "FFNOVATO"
+#define VERSAO_SNAPSHOT 2
+#define MARCA_ORDEM_BYTES 0x01020304u
+#define REGISTROS_POR_ESCRITA 1024
+
+typedef struct
+{
+    char assinatura[8];                // ASSINATURA_SNAPSHOT (sem '\0')
+    unsigned int versao;               // VERSAO_SNAPSHOT
+    unsigned int ordemBytes;           // MARCA_ORDEM_BYTES na ordem de quem gravou
+    unsigned int tamanhoRegistro;      // sizeof(Item) de quem gravou
+    unsigned int epocaDiario;          // época do diário (seção DIÁRIO DE OPERAÇÕES)
+    unsigned int totalTipos;           // nomes do dicionário logo após o cabeçalho
+    unsigned int tamanhoTipo;          // TAMANHO_TIPO de quem gravou
+    unsigned long long totalRegistros; // registros logo após o dicionário
+} CabecalhoSnapshot;
+
+unsigned int epocaSnapshot = 0;  // Época do snapshot carregado ou gravado por último
+void *regiaoMapeada = NULL;      // Arquivo mapeado que serve de mochila (ou NULL)
+size_t tamanhoMapeado = 0;       // Bytes mapeados
+const char *motivoSnapshot = ""; // Motivo da última falha de carga
+
+/*
+ * Função: bytesDoDicionario
+ * Descrição: calcula o espaço ocupado pelo dicionário no arquivo
+ * Parâmetros: número de tipos
+ * Retorno: bytes, arredondados para múltiplo de 8 (os registros que
+ *          vêm depois ficam alinhados no mapeamento)
+ */
+long long bytesDoDicionario(unsigned int tipos)
+{
+    return ((long long)tipos * TAMANHO_TIPO + 7) / 8 * 8;
+}
+
+/*
+ * Função: carregarTipos
+ * Descrição: substitui o dicionário de tipos pelo gravado no snapshot
+ * Parâmetros: nomes lidos do arquivo, número de tipos
+ * Retorno: nenhum
+ *
+ * Os números são preservados, então os registros continuam valendo
+ * sem serem tocados. Nomes sem '\0' são truncados.
+ */
+void carregarTipos(const char *nomes, unsigned int tipos)
+{
+    memset(nomesTipos, 0, sizeof(nomesTipos));
+    for (unsigned int i = 0; i < tipos; i++)
+    {
+        const char *nome = nomes + (size_t)i * TAMANHO_TIPO;
+        memcpy(nomesTipos[i], nome, strnlen(nome, TAMANHO_TIPO - 1));
+    }
+    totalTipos = (int)tipos;
+}
+
+/*
+ * Função: validarCabecalho
+ * Descrição: confere se o cabeçalho descreve um snapshot legível aqui
+ * Parâmetros: cabeçalho, tamanho do arquivo em bytes
+ * Retorno: número de registros, ou -1 (motivo em motivoSnapshot)
+ */
+long long validarCabecalho(const CabecalhoSnapshot *cabecalho, long long tamanhoArquivo)
+{
+    if (memcmp(cabecalho->assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho->assinatura)) != 0)
+    {
+        motivoSnapshot = "não é um snapshot do nível novato";
+        return -1;
+    }
+    if (cabecalho->ordemBytes != MARCA_ORDEM_BYTES)
+    {
+        motivoSnapshot = "gravado em uma máquina com outra ordem de bytes";
+        return -1;
+    }
+    if (cabecalho->versao != VERSAO_SNAPSHOT)
+    {
+        motivoSnapshot = "versão do formato não suportada";
+        return -1;
+    }
+    if (cabecalho->tamanhoRegistro != sizeof(Item) || cabecalho->tamanhoTipo != TAMANHO_TIPO)
+    {
+        motivoSnapshot = "tamanho de registro diferente deste programa";
+        return -1;
+    }
+    if (cabecalho->totalTipos > MAX_TIPOS)
+    {
+        motivoSnapshot = "dicionário de tipos maior que o suportado";
+        return -1;
+    }
+
+    long long inicio = (long long)sizeof(CabecalhoSnapshot) + bytesDoDicionario(cabecalho->totalTipos);
+    long long espaco = tamanhoArquivo < inicio ? -1 : (tamanhoArquivo - inicio) / (long long)sizeof(Item);
+    if (cabecalho->totalRegistros > INT_MAX || (long long)cabecalho->totalRegistros != espaco ||
+        espaco * (long long)sizeof(Item) + inicio != tamanhoArquivo)
+    {
+        motivoSnapshot = "tamanho do arquivo não confere com o cabeçalho";
+        return -1;
+    }
+
+    return (long long)cabecalho->totalRegistros;
+}
+
+/*
+ * Função: desmapearMochila
+ * Descrição: desfaz o mapeamento do snapshot (a mochila já deve ter
+ *            sido copiada ou descartada)
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void desmapearMochila()
+{
+#ifndef _WIN32
+    if (regiaoMapeada != NULL)
+    {
+        munmap(regiaoMapeada, tamanhoMapeado);
+    }
+#endif
+    regiaoMapeada = NULL;
+    tamanhoMapeado = 0;
+}
+
+/*
+ * Função: carregarSnapshot
+ * Descrição: abre um snapshot e passa a usá-lo como mochila
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se carregado, 0 se o arquivo não existe, -1 se inválido
+ *          (motivo em motivoSnapshot)
+ *
+ * Deve ser chamada com a mochila e o dicionário de tipos vazios,
+ * antes de qualquer operação.
+ */
+int carregarSnapshot(const char *caminho)
+{
+    long long total;
+    Item *itens = NULL;
+
+#ifdef _WIN32
+    FILE *arquivo = fopen(caminho, "rb");
+    CabecalhoSnapshot cabecalho;
+
+    if (arquivo == NULL)
+    {
+        motivoSnapshot = strerror(errno);
+        return errno == ENOENT ? 0 : -1;
+    }
+
+    fseek(arquivo, 0, SEEK_END);
+    long long tamanhoArquivo = ftell(arquivo);
+    rewind(arquivo);
+
+    if (fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1)
+    {
+        fclose(arquivo);
+        motivoSnapshot = "arquivo menor que o cabeçalho";
+        return -1;
+    }
+
+    static char nomes[MAX_TIPOS * TAMANHO_TIPO + 8];
+
+    total = validarCabecalho(&cabecalho, tamanhoArquivo);
+    epocaSnapshot = cabecalho.epocaDiario;
+    if (total >= 0)
+    {
+        size_t bytes = (size_t)bytesDoDicionario(cabecalho.totalTipos);
+        if (fread(nomes, 1, bytes, arquivo) != bytes)
+        {
+            motivoSnapshot = "erro de leitura";
+            total = -1;
+        }
+        else
+        {
+            carregarTipos(nomes, cabecalho.totalTipos);
+        }
+    }
+    if (total > 0)
+    {
+        itens = (Item *)malloc((size_t)total * sizeof(Item));
+        if (itens == NULL || fread(itens, sizeof(Item), (size_t)total, arquivo) != (size_t)total)
+        {
+            motivoSnapshot = itens == NULL ? "memória insuficiente" : "erro de leitura";
+            free(itens);
+            total = -1;
+        }
+    }
+    fclose(arquivo);
+
+    if (total < 0)
+    {
+        return -1;
+    }
+#else
+    int descritor = open(caminho, O_RDONLY);
+    struct stat info;
+
+    if (descritor == -1)
+    {
+        motivoSnapshot = strerror(errno);
+        return errno == ENOENT ? 0 : -1;
+    }
+
+    if (fstat(descritor, &info) != 0 || info.st_size < (off_t)sizeof(CabecalhoSnapshot))
+    {
+        close(descritor);
+        motivoSnapshot = "arquivo menor que o cabeçalho";
+        return -1;
+    }
+
+    // Cópia na escrita: a mochila pode ser alterada sem tocar no arquivo
+    void *regiao = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descritor, 0);
+    close(descritor); // o mapeamento continua válido
+
+    if (regiao == MAP_FAILED)
+    {
+        motivoSnapshot = strerror(errno);
+        return -1;
+    }
+
+    const CabecalhoSnapshot *cabecalho = (const CabecalhoSnapshot *)regiao;
+    total = validarCabecalho(cabecalho, (long long)info.st_size);
+    epocaSnapshot = cabecalho->epocaDiario;
+    if (total >= 0)
+    {
+        carregarTipos((const char *)regiao + sizeof(CabecalhoSnapshot), cabecalho->totalTipos);
+    }
+    if (total <= 0)
+    {
+        munmap(regiao, (size_t)info.st_size);
+        if (total < 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        regiaoMapeada = regiao;
+        tamanhoMapeado = (size_t)info.st_size;
+        itens = (Item *)((char *)regiao + sizeof(CabecalhoSnapshot) + bytesDoDicionario(cabecalho->totalTipos));
+    }
+#endif
+
+    // Snapshot vazio: a mochila continua sem vetor e recebe a reserva
+    if (total > 0)
+    {
+        mochila = itens;
+        capacidadeMochila = (int)total;
+        posicoesOcupadas = (int)total;
+        totalItens = (int)total;
+        totalLapides = 0;
+        estruturasPendentes = 1;
+    }
+    return 1;
+}
+
+/*
+ * Função: prepararEstruturas
+ * Descrição: monta o índice hash e o mapa de slots de uma mochila
+ *            recém-carregada (nada faz se já estiverem prontos)
+ * Parâmetros: nenhum
+ * Retorno: 1 se prontos, 0 se faltou memória
+ *
+ * Também garante que cada registro lido seja utilizável (nomes
+ * terminados, sem lápides, slot igual à posição). Um número de tipo
+ * fora do dicionário é mantido e aparece como "?". Registros gravados
+ * por salvarSnapshot já estão assim, então o arquivo mapeado só é
+ * lido: nenhuma página é copiada.
+ */
+int prepararEstruturas()
+{
+    if (!estruturasPendentes)
+    {
+        return 1;
+    }
+
+    int capacidade = posicoesOcupadas > CAPACIDADE_INICIAL ? posicoesOcupadas : CAPACIDADE_INICIAL;
+    SlotItem *novosSlots = (SlotItem *)malloc((size_t)capacidade * sizeof(SlotItem));
+
+    if (novosSlots == NULL)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < posicoesOcupadas; i++)
+    {
+        Item *item = &mochila[i];
+
+        if (memchr(item->nome, '\0', sizeof(item->nome)) == NULL)
+        {
+            item->nome[sizeof(item->nome) - 1] = '\0';
+        }
+        if (item->removido != 0)
+        {
+            item->removido = 0;
+        }
+        if (item->slot != i)
+        {
+            item->slot = i;
+        }
+
+        novosSlots[i].posicao = i;
+        novosSlots[i].geracao = 1;
+    }
+
+    // Ocupação abaixo de 50%, como em garantirEspacoIndice
+    long long capacidadeTabela = CAPACIDADE_MINIMA_INDICE;
+    while (capacidadeTabela <= 2LL * totalItens)
+    {
+        capacidadeTabela *= 2;
+    }
+
+    if (capacidadeTabela > INT_MAX || !reconstruirIndice((int)capacidadeTabela))
+    {
+        free(novosSlots);
+        return 0;
+    }
+
+    free(slots);
+    slots = novosSlots;
+    totalSlots = posicoesOcupadas;
+    capacidadeSlots = capacidade;
+    primeiroSlotLivre = -1;
+    estruturasPendentes = 0;
+    return 1;
+}
+
+/*
+ * Função: sincronizarArquivo
+ * Descrição: esvazia o buffer de um arquivo e força os dados para o disco
+ * Parâmetros: arquivo aberto para escrita
+ * Retorno: 1 se sucesso, 0 se falhou
+ */
+int sincronizarArquivo(FILE *arquivo)
+{
+    if (fflush(arquivo) != 0)
+    {
+        return 0;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(arquivo)) == 0;
+#else
+    return fsync(fileno(arquivo)) == 0;
+#endif
+}
+
+/*
+ * Função: sincronizarPasta
+ * Descrição: força para o disco a pasta de um arquivo (uma renomeação
+ *            só sobrevive a uma queda de energia depois disso)
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se sucesso, 0 se falhou
+ *
+ * No Windows uma pasta não pode ser aberta com open para o fsync;
+ * nada é feito.
+ */
+int sincronizarPasta(const char *caminho)
+{
+#ifdef _WIN32
+    (void)caminho;
+    return 1;
+#else
+    char pasta[FILENAME_MAX] = ".";
+    const char *barra = strrchr(caminho, '/');
+
+    if (barra != NULL)
+    {
+        size_t tamanho = barra == caminho ? 1 : (size_t)(barra - caminho); // "/arquivo" fica na raiz
+        if (tamanho >= sizeof(pasta))
+        {
+            return 0;
+        }
+        memcpy(pasta, caminho, tamanho);
+        pasta[tamanho] = '\0';
+    }
+
+    int descritor = open(pasta, O_RDONLY);
+    if (descritor == -1)
+    {
+        return 0;
+    }
+
+    int sucesso = fsync(descritor) == 0;
+    close(descritor);
+    return sucesso;
+#endif
+}
+
+/*
+ * Função: salvarSnapshot
+ * Descrição: grava os itens ativos da mochila no formato de snapshot
+ * Parâmetros: caminho do arquivo
+ * Retorno: 1 se sucesso; 0 se não foi possível gravar (o snapshot
+ *          anterior continua no lugar); -1 se o arquivo foi trocado
+ *          mas a pasta não pôde ser sincronizada (após uma queda de
+ *          energia, o disco pode ter qualquer um dos dois)
+ *
+ * Escreve em "caminho.tmp", força os dados para o disco e só então
+ * renomeia: uma queda no meio da gravação deixa o snapshot anterior
+ * intacto. Depois da renomeação a pasta também vai para o disco, para
+ * que ninguém (o diário, em particular) aja como se o snapshot novo
+ * estivesse gravado antes de ele estar. Cada registro é zerado antes
+ * de preenchido, então o mesmo inventário gera sempre o mesmo arquivo.
+ */
+int salvarSnapshot(const char *caminho)
+{
+    char temporario[FILENAME_MAX];
+    static Item bloco[REGISTROS_POR_ESCRITA];
+
+    if (snprintf(temporario, sizeof(temporario), "%s.tmp", caminho) >= (int)sizeof(temporario))
+    {
+        return 0;
+    }
+
+    FILE *arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL)
+    {
+        return 0;
+    }
+
+    CabecalhoSnapshot cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.assinatura, ASSINATURA_SNAPSHOT, sizeof(cabecalho.assinatura));
+    cabecalho.versao = VERSAO_SNAPSHOT;
+    cabecalho.ordemBytes = MARCA_ORDEM_BYTES;
+    cabecalho.tamanhoRegistro = sizeof(Item);
+    cabecalho.epocaDiario = epocaSnapshot;
+    cabecalho.totalTipos = (unsigned int)totalTipos;
+    cabecalho.tamanhoTipo = TAMANHO_TIPO;
+    cabecalho.totalRegistros = (unsigned long long)totalItens;
+
+    static const char zeros[8];
+    size_t bytesTipos = (size_t)totalTipos * TAMANHO_TIPO;
+    size_t preenchimento = (size_t)bytesDoDicionario((unsigned int)totalTipos) - bytesTipos;
+
+    int sucesso = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 &&
+                  fwrite(nomesTipos, 1, bytesTipos, arquivo) == bytesTipos &&
+                  fwrite(zeros, 1, preenchimento, arquivo) == preenchimento;
+    int gravados = 0;
+    int noBloco = 0;
+
+    for (int i = 0; sucesso && i < posicoesOcupadas; i++)
+    {
+        if (mochila[i].removido)
+        {
+            continue;
+        }
+
+        // Zera também o preenchimento entre os campos
+        Item *registro = &bloco[noBloco];
+        memset(registro, 0, sizeof(*registro));
+        memcpy(registro->nome, mochila[i].nome, strnlen(mochila[i].nome, sizeof(registro->nome) - 1));
+        registro->tipo = mochila[i].tipo;
+        registro->quantidade = mochila[i].quantidade;
+        registro->slot = gravados + noBloco;
+
+        if (++noBloco == REGISTROS_POR_ESCRITA)
+        {
+            sucesso = fwrite(bloco, sizeof(Item), (size_t)noBloco, arquivo) == (size_t)noBloco;
+            gravados += noBloco;
+            noBloco = 0;
+        }
+    }
+
+    if (sucesso && noBloco > 0)
+    {
+        sucesso = fwrite(bloco, sizeof(Item), (size_t)noBloco, arquivo) == (size_t)noBloco;
+    }
+
+    sucesso = sucesso && sincronizarArquivo(arquivo);
+    if (fclose(arquivo) != 0)
+    {
+        sucesso = 0;
+    }
+
+#ifdef _WIN32
+    if (sucesso)
+    {
+        remove(caminho); // rename não substitui arquivos no Windows
+    }
+#endif
+
+    if (!sucesso || rename(temporario, caminho) != 0)
+    {
+        remove(temporario);
+        return 0;
+    }
+    return sincronizarPasta(caminho) ? 1 : -1;
+}
+
+/* ========================================
+ * ARMAZENAMENTO DINÂMICO
+ * ========================================
+ *
+ * A mochila dobra de tamanho quando enche (inserção amortizada O(1))
+ * e volta à metade quando fica com até 1/4 da capacidade ocupada,
+ * nunca abaixo da reserva inicial. Assim a memória acompanha o
+ * volume de itens mesmo depois de grandes remoções.
+ */
+
+/*
+ * Função: redimensionarMochila
+ * Descrição: realoca o vetor da mochila para a nova capacidade
+ * Parâmetros: nova capacidade (deve ser >= posicoesOcupadas)
+ * Retorno: 1 se sucesso, 0 se faltou memória (vetor antigo é mantido)
+ *
+ * Se a mochila ainda é um snapshot mapeado, os itens são copiados
+ * para o heap e o mapeamento é desfeito.
+ */
+int redimensionarMochila(int novaCapacidade)
+{
+    Item *novoVetor;
+
+    if (regiaoMapeada != NULL)
+    {
+        novoVetor = (Item *)malloc((size_t)novaCapacidade * sizeof(Item));
+        if (novoVetor == NULL)
+        {
+            return 0;
+        }
+        memcpy(novoVetor, mochila, (size_t)posicoesOcupadas * sizeof(Item));
+        desmapearMochila();
+    }
+    else
+    {
+        novoVetor = (Item *)realloc(mochila, (size_t)novaCapacidade * sizeof(Item));
+        if (novoVetor == NULL)
+        {
+            return 0;
+        }
+    }
+
+    mochila = novoVetor;
+    capacidadeMochila = novaCapacidade;
+    return 1;
+}
+
+/*
+ * Função: compactarMochila
+ * Descrição: elimina as lápides, aproximando os itens restantes
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Preserva a ordem dos itens e reconstrói o índice hash, já que as
+ * posições mudam. Custa O(n), mas só roda depois de uma fração fixa
+ * de remoções, então cada remoção sai por O(1) amortizado.
+ */
+void compactarMochila()
+{
+    if (totalLapides == 0)
+    {
+        return;
+    }
+
+    int destino = 0;
+    for (int i = 0; i < posicoesOcupadas; i++)
+    {
+        if (!mochila[i].removido)
+        {
+            if (destino != i)
+            {
+                mochila[destino] = mochila[i];
+                slots[mochila[destino].slot].posicao = destino;
+            }
+            destino++;
+        }
+    }
+
+    posicoesOcupadas = destino;
+    totalLapides = 0;
+
+    // Mesma tabela: só recalcula as posições (não aloca memória)
+    preencherTabela(indiceNomes, capacidadeIndice);
+}
+
+/*
+ * Função: garantirEspacoMochila
+ * Descrição: garante espaço para mais um item, dobrando se necessário
+ * Parâmetros: nenhum
+ * Retorno: 1 se há espaço, 0 se faltou memória
+ */
+int garantirEspacoMochila()
+{
+    if (posicoesOcupadas < capacidadeMochila)
+    {
+        return 1;
+    }
+
+    int novaCapacidade = capacidadeMochila > 0 ? capacidadeMochila * 2 : reservaInicial;
+    return redimensionarMochila(novaCapacidade);
+}
+
+/*
+ * Função: encolherMochila
+ * Descrição: devolve memória quando a mochila fica pouco ocupada
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ */
+void encolherMochila()
+{
+    if (capacidadeMochila <= reservaInicial || posicoesOcupadas > capacidadeMochila / 4)
+    {
+        return;
+    }
+
+    int novaCapacidade = capacidadeMochila / 2;
+    if (novaCapacidade < reservaInicial)
+    {
+        novaCapacidade = reservaInicial;
+    }
+
+    // Se o realloc falhar, o vetor maior continua válido
+    redimensionarMochila(novaCapacidade);
+}
+
+/*
+ * Função: liberarMochila
+ * Descrição: libera toda a memória da mochila
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Importante: deve ser chamada ao sair do programa
+ */
+void liberarMochila()
+{
+    if (regiaoMapeada != NULL)
+    {
+        desmapearMochila();
+    }
+    else
+    {
+        free(mochila);
+    }
+    mochila = NULL;
+    totalItens = 0;
+    posicoesOcupadas = 0;
+    totalLapides = 0;
+    capacidadeMochila = 0;
+    estruturasPendentes = 0;
+    liberarIndice();
+    liberarSlots();
+}
+
+/* ========================================
+ * OPERAÇÕES BÁSICAS (SEM INTERFACE)
+ * ========================================
+ *
+ * Funções usadas tanto pelo menu interativo quanto pelo modo roteiro.
+ * Não imprimem nada: apenas alteram ou consultam a mochila.
+ */
+
+/*
+ * Função: buscarIndiceItem
+ * Descrição: procura um item pelo nome usando o índice hash
+ * Parâmetros: nome do item
+ * Retorno: índice do item ou -1 se não encontrado
+ *
+ * O número de sondagens fica em sondagensHash.
+ */
+int buscarIndiceItem(const char *nome)
+{
+    if (!prepararEstruturas())
+    {
+        return -1;
+    }
+    return buscarNoIndice(nome);
+}
+
+/*
+ * Função: adicionarItemMochila
+ * Descrição: grava um novo item no final da mochila
+ * Parâmetros: nome, tipo e quantidade do item; handle de saída (ou NULL)
+ * Retorno: 1 se sucesso, 0 se faltou memória ou o tipo é novo e o
+ *          dicionário de tipos está cheio
+ *
+ * Nomes e tipos maiores que o campo são truncados.
+ */
+int adicionarItemMochila(const char *nome, const char *tipo, int quantidade, Handle *handle)
+{
+    Handle novoHandle;
+    int numeroTipo = internarTipo(tipo);
+
+    if (numeroTipo == -1 || !prepararEstruturas() || !garantirEspacoMochila() || !garantirEspacoIndice() ||
+        !alocarSlot(posicoesOcupadas, &novoHandle))
+    {
+        return 0;
+    }
+
+    Item *novo = &mochila[posicoesOcupadas];
+    snprintf(novo->nome, sizeof(novo->nome), "%s", nome);
+    novo->tipo = (unsigned char)numeroTipo;
+    novo->quantidade = quantidade;
+    novo->removido = 0;
+    novo->slot = novoHandle.slot;
+
+    // Daqui em diante nada falha: o registro entra antes da mudança
+    registrarNoDiario(DIARIO_ADICIONAR, posicoesOcupadas, quantidade);
+
+    if (handle != NULL)
+    {
+        *handle = novoHandle;
+    }
+
+    indexarItem(posicoesOcupadas);
+    posicoesOcupadas++;
+    totalItens++;
+    mochilaAlterada = 1;
+    return 1;
+}
+
+/*
+ * Função: removerPosicao
+ * Descrição: remove o item de uma posição da mochila
+ * Parâmetros: posição de um item ativo
+ * Retorno: nenhum
+ *
+ * Mantém a ordem dos itens restantes. No modo lápide, apenas marca a
+ * posição e compacta quando as lápides passam de 1/4 das posições.
+ */
+void removerPosicao(int indice)
+{
+    registrarNoDiario(DIARIO_REMOVER, indice, 0);
+    desindexarItem(indice);
+    liberarSlot(mochila[indice].slot);
+    totalItens--;
+    mochilaAlterada = 1;
+
+    if (modoRemocao == REMOCAO_LAPIDE)
+    {
+        mochila[indice].removido = 1;
+        totalLapides++;
+
+        if (totalLapides * FRACAO_MAXIMA_LAPIDES > posicoesOcupadas)
+        {
+            compactarMochila();
+        }
+    }
+    else
+    {
+        // Desloca todos os itens posteriores uma posição para frente
+        for (int i = indice; i < posicoesOcupadas - 1; i++)
+        {
+            mochila[i] = mochila[i + 1];
+            slots[mochila[i].slot].posicao = i;
+        }
+        posicoesOcupadas--;
+        ajustarPosicoesIndice(indice);
+    }
+
+    encolherMochila();
+    encolherIndice();
+}
+
+/*
+ * Função: removerItemMochila
+ * Descrição: remove o primeiro item com o nome informado
+ * Parâmetros: nome do item
+ * Retorno: 1 se removido, 0 se não encontrado
+ */
+int removerItemMochila(const char *nome)
+{
+    int indice = buscarIndiceItem(nome);
+
+    if (indice == -1)
+    {
+        return 0;
+    }
+
+    removerPosicao(indice);
+    return 1;
+}
+
+/*
+ * Função: removerItemPorHandle
+ * Descrição: remove o item referenciado por um handle, sem buscar o nome
+ * Parâmetros: handle
+ * Retorno: 1 se removido, 0 se o handle é inválido
+ */
+int removerItemPorHandle(Handle handle)
+{
+    int indice = resolverHandle(handle);
+
+    if (indice == -1)
+    {
+        return 0;
+    }
+
+    removerPosicao(indice);
+    return 1;
+}
+
+/*
+ * Função: consumirItemPorHandle
+ * Descrição: retira unidades do item de um handle (ex: usar 1 kit médico)
+ * Parâmetros: handle, unidades a consumir
+ * Retorno: quantidade restante, ou -1 se o handle é inválido ou não há
+ *          unidades suficientes
+ *
+ * O item é removido quando a quantidade chega a zero.
+ */
+int consumirItemPorHandle(Handle handle, int unidades)
+{
+    int indice = resolverHandle(handle);
+
+    if (indice == -1 || unidades <= 0 || unidades > mochila[indice].quantidade)
+    {
+        return -1;
+    }
+
+    int restante = mochila[indice].quantidade - unidades;
+
+    if (restante == 0)
+    {
+        removerPosicao(indice);
+    }
+    else
+    {
+        registrarNoDiario(DIARIO_QUANTIDADE, indice, restante);
+        mochila[indice].quantidade = restante;
+        mochilaAlterada = 1;
+    }
+    return restante;
+}
+
+/* ========================================
+ * DIÁRIO DE OPERAÇÕES
+ * ========================================
+ *
+ * Com --diario, cada mudança na mochila (adicionar, remover, mudar a
+ * quantidade) vira um RegistroDiario de tamanho fixo gravado no fim de
+ * "snapshot.diario" antes de ser aplicada. Gravar o inventário inteiro
+ * só acontece na compactação.
+ *
+ * Group commit: os registros passam pelo buffer do arquivo e o fsync
+ * só é feito a cada grupoDiario registros (e sempre antes de mostrar
+ * o menu, então no modo interativo cada operação confirmada já está no
+ * disco). No modo roteiro, uma queda perde no máximo as grupoDiario - 1
+ * operações mais recentes; com --grupo 1 não perde nenhuma.
+ *
+ * Recuperação: na abertura, os registros são reaplicados sobre o
+ * snapshot na ordem em que foram gravados. Um registro com a soma de
+ * verificação errada ou incompleto marca o fim do que chegou ao disco.
+ *
+ * Compactação: quando o diário passa de max(DIARIO_MINIMO_COMPACTACAO,
+ * totalItens) registros, e ao sair, o estado atual vira um snapshot
+ * novo e o diário recomeça vazio. O custo é proporcional ao inventário,
+ * mas só acontece depois de pelo menos outro tanto de operações.
+ *
+ * Épocas: cada compactação incrementa a época gravada no snapshot, e
+ * cada registro leva a época do snapshot a que se aplica. Se o programa
+ * cair entre gravar o snapshot e esvaziar o diário, os registros que
+ * sobraram são de uma época antiga e não são reaplicados duas vezes.
+ * O diário só é esvaziado depois que a renomeação do snapshot chegou
+ * ao disco (sincronizarPasta); um registro de época mais nova que o
+ * snapshot indica que o snapshot se perdeu e impede a abertura, em
+ * vez de descartar operações confirmadas.
+ *
+ * Falha de gravação: um registro gravado pela metade no meio do
+ * diário esconderia todos os seguintes na reaplicação. Por isso, na
+ * primeira falha o diário para de registrar (interromperDiario) e o
+ * estado completo vai para o snapshot ao sair.
+ *
+ * Os itens são identificados por nome e ocorrência (qual dos itens com
+ * esse nome, na ordem da mochila), que não mudam com lápides, modo de
+ * remoção ou compactação, ao contrário de posições e slots.
+ */
+
+#define DIARIO_GRUPO_PADRAO 32          // registros por fsync
+#define DIARIO_MINIMO_COMPACTACAO 4096  // registros antes de compactar
+
+typedef struct
+{
+    unsigned int epoca;       // época do snapshot a que o registro se aplica
+    unsigned int verificacao; // FNV-1a do registro, com este campo zerado
+    int operacao;             // OperacaoDiario
+    int ocorrencia;           // remover/quantidade: 0 = primeiro item com o nome
+    int quantidade;           // adicionar: quantidade inicial; quantidade: novo valor
+    char nome[30];
+    char tipo[20];
+} RegistroDiario;
+
+FILE *arquivoDiario = NULL;             // Diário aberto (NULL = desligado)
+char caminhoDiario[FILENAME_MAX];       // "snapshot.diario"
+const char *snapshotDoDiario = NULL;    // Snapshot que recebe as compactações
+int grupoDiario = DIARIO_GRUPO_PADRAO;  // Registros por fsync
+int registrosNoDiario = 0;              // Registros desde a última compactação
+int registrosSemSincronizar = 0;        // Gravados, mas ainda sem fsync
+int sincronizacoesDiario = 0;           // fsyncs do diário nesta sessão
+int adiamentoCompactacao = 0;           // Registros extras tolerados após uma compactação falha
+int falhaDiario = 0;                    // 1 se alguma gravação do diário falhou
+int diarioInterrompido = 0;             // 1: parou de registrar; o snapshot é gravado inteiro ao sair
+const char *motivoDiario = "";          // Motivo da última falha na reaplicação
+
+/*
+ * Função: verificarRegistro
+ * Descrição: calcula a soma de verificação de um registro do diário
+ * Parâmetros: registro
+ * Retorno: hash FNV-1a de 32 bits dos bytes do registro, com o campo
+ *          verificacao tratado como zero
+ */
+unsigned int verificarRegistro(const RegistroDiario *registro)
+{
+    RegistroDiario copia = *registro;
+    const unsigned char *bytes = (const unsigned char *)&copia;
+    unsigned int hash = 2166136261u;
+
+    copia.verificacao = 0;
+    for (size_t i = 0; i < sizeof(copia); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*
+ * Função: interromperDiario
+ * Descrição: para de registrar após uma falha de gravação
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Nada mais é acrescentado depois de um registro que pode ter ficado
+ * pela metade: na reaplicação ele é o fim do diário, não um buraco no
+ * meio. As mudanças seguintes ficam só na memória até fecharDiario
+ * gravar o snapshot.
+ */
+void interromperDiario()
+{
+    falhaDiario = 1;
+    diarioInterrompido = 1;
+    if (arquivoDiario != NULL)
+    {
+        fclose(arquivoDiario);
+        arquivoDiario = NULL;
+    }
+    fprintf(stderr, "Aviso: falha ao gravar o diário '%s'; as próximas mudanças só serão gravadas ao sair\n",
+            caminhoDiario);
+}
+
+/*
+ * Função: sincronizarDiario
+ * Descrição: leva ao disco os registros ainda pendentes (um fsync só
+ *            para o grupo inteiro)
+ * Parâmetros: nenhum
+ * Retorno: 1 se sucesso (ou nada pendente), 0 se falhou
+ */
+int sincronizarDiario()
+{
+    if (arquivoDiario == NULL || registrosSemSincronizar == 0)
+    {
+        return 1;
+    }
+
+    registrosSemSincronizar = 0;
+    sincronizacoesDiario++;
+
+    if (!sincronizarArquivo(arquivoDiario))
+    {
+        interromperDiario();
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Função: compactarDiario
+ * Descrição: grava o estado atual como snapshot da próxima época e
+ *            esvazia o diário
+ * Parâmetros: nenhum
+ * Retorno: 1 se sucesso, 0 se o snapshot não pôde ser gravado ou
+ *          confirmado no disco (o diário continua valendo e segue
+ *          crescendo)
+ *
+ * Também serve para um diário interrompido: o snapshot novo recebe
+ * tudo o que ficou só na memória e o diário recomeça.
+ */
+int compactarDiario()
+{
+    epocaSnapshot++;
+    int gravado = salvarSnapshot(snapshotDoDiario);
+
+    if (gravado == 0)
+    {
+        epocaSnapshot--;
+        falhaDiario = 1;
+        return 0;
+    }
+    if (gravado == -1)
+    {
+        // O arquivo já é da época nova, mas pode voltar a ser o antigo
+        // após uma queda: o diário fica inteiro e os próximos registros
+        // já levam a época nova
+        falhaDiario = 1;
+        return 0;
+    }
+
+    // O snapshot novo já contém tudo: os registros antigos viram lixo
+    if (arquivoDiario != NULL)
+    {
+        fclose(arquivoDiario);
+    }
+    arquivoDiario = fopen(caminhoDiario, "wb");
+    registrosNoDiario = 0;
+    registrosSemSincronizar = 0;
+    adiamentoCompactacao = 0;
+    mochilaAlterada = 0;
+
+    if (arquivoDiario == NULL)
+    {
+        falhaDiario = 1;
+        diarioInterrompido = 1;
+        return 0;
+    }
+    diarioInterrompido = 0;
+    return 1;
+}
+
+/*
+ * Função: registrarNoDiario
+ * Descrição: grava no diário uma mudança que está para ser aplicada
+ * Parâmetros: operação, posição do item (em DIARIO_ADICIONAR, a posição
+ *             onde o item novo já foi preenchido) e quantidade (inicial
+ *             ou nova; ignorada em DIARIO_REMOVER)
+ * Retorno: nenhum
+ *
+ * Deve ser chamada antes de a mudança alterar a mochila: se o diário
+ * precisar ser compactado, o snapshot gravado não pode incluí-la.
+ */
+void registrarNoDiario(OperacaoDiario operacao, int posicao, int quantidade)
+{
+    if (arquivoDiario == NULL)
+    {
+        return;
+    }
+
+    long long limite = totalItens > DIARIO_MINIMO_COMPACTACAO ? totalItens : DIARIO_MINIMO_COMPACTACAO;
+    if (registrosNoDiario >= limite + adiamentoCompactacao && !compactarDiario())
+    {
+        if (arquivoDiario == NULL)
+        {
+            return;
+        }
+        // Sem espaço para o snapshot: tenta de novo só depois de outro tanto
+        adiamentoCompactacao = registrosNoDiario;
+    }
+
+    RegistroDiario registro;
+    memset(&registro, 0, sizeof(registro));
+    registro.epoca = epocaSnapshot;
+    registro.operacao = operacao;
+    registro.ocorrencia = operacao == DIARIO_ADICIONAR ? 0 : ocorrenciaNoIndice(posicao);
+    registro.quantidade = quantidade;
+    memcpy(registro.nome, mochila[posicao].nome, strnlen(mochila[posicao].nome, sizeof(registro.nome) - 1));
+    const char *tipo = nomeDoTipo(mochila[posicao].tipo); // o diário guarda o nome, não o número
+    memcpy(registro.tipo, tipo, strnlen(tipo, sizeof(registro.tipo) - 1));
+    registro.verificacao = verificarRegistro(&registro);
+
+    if (fwrite(&registro, sizeof(registro), 1, arquivoDiario) != 1)
+    {
+        interromperDiario();
+        return;
+    }
+    registrosNoDiario++;
+
+    if (++registrosSemSincronizar >= grupoDiario)
+    {
+        sincronizarDiario();
+    }
+}
+
+/*
+ * Função: reaplicarDiario
+ * Descrição: refaz sobre a mochila as operações de um diário
+ * Parâmetros: arquivo do diário aberto para leitura, saída para o
+ *             número de registros descartados no final
+ * Retorno: registros reaplicados, ou -1 se o diário não corresponde ao
+ *          snapshot (motivo em motivoDiario)
+ *
+ * Registros de época anterior à do snapshot já estão nele e são
+ * pulados. Um registro de época posterior só existe se o snapshot em
+ * que ele se baseia não chegou ao disco: é erro, não descarte.
+ *
+ * O diário deve estar fechado para gravação (arquivoDiario == NULL),
+ * senão as próprias operações reaplicadas seriam registradas de novo.
+ */
+int reaplicarDiario(FILE *arquivo, int *descartados)
+{
+    RegistroDiario registro;
+    int aplicados = 0;
+    size_t lidos;
+
+    *descartados = 0;
+
+    while ((lidos = fread(&registro, 1, sizeof(registro), arquivo)) > 0)
+    {
+        // Final gravado pela metade ou corrompido: o resto não chegou ao disco
+        if (lidos < sizeof(registro) || verificarRegistro(&registro) != registro.verificacao)
+        {
+            (*descartados)++;
+            while (fread(&registro, sizeof(registro), 1, arquivo) == 1)
+            {
+                (*descartados)++;
+            }
+            break;
+        }
+
+        // Época antiga: a operação já está no snapshot
+        if (registro.epoca < epocaSnapshot)
+        {
+            continue;
+        }
+        if (registro.epoca > epocaSnapshot)
+        {
+            motivoDiario = "o diário é de um snapshot mais novo que o carregado";
+            return -1;
+        }
+
+        registro.nome[sizeof(registro.nome) - 1] = '\0';
+        registro.tipo[sizeof(registro.tipo) - 1] = '\0';
+
+        if (!prepararEstruturas())
+        {
+            motivoDiario = "memória insuficiente";
+            return -1;
+        }
+
+        int posicao = -1;
+        if (registro.operacao != DIARIO_ADICIONAR)
+        {
+            posicao = posicaoDaOcorrencia(registro.nome, registro.ocorrencia);
+            if (posicao == -1)
+            {
+                motivoDiario = "o diário cita um item que não está na mochila";
+                return -1;
+            }
+        }
+
+        if (registro.operacao == DIARIO_ADICIONAR && registro.quantidade > 0)
+        {
+            if (!adicionarItemMochila(registro.nome, registro.tipo, registro.quantidade, NULL))
+            {
+                motivoDiario = "memória insuficiente";
+                return -1;
+            }
+        }
+        else if (registro.operacao == DIARIO_REMOVER)
+        {
+            removerPosicao(posicao);
+        }
+        else if (registro.operacao == DIARIO_QUANTIDADE && registro.quantidade > 0)
+        {
+            mochila[posicao].quantidade = registro.quantidade;
+            mochilaAlterada = 1;
+        }
+        else
+        {
+            motivoDiario = "registro com operação inválida";
+            return -1;
+        }
+        aplicados++;
+    }
+
+    return aplicados;
+}
+
+/*
+ * Função: abrirDiario
+ * Descrição: reaplica o diário do snapshot (se houver) e o deixa aberto
+ *            para registrar as próximas operações
+ * Parâmetros: caminho do snapshot (já carregado), saída para o número de
+ *             registros descartados no final do diário
+ * Retorno: registros reaplicados, ou -1 se falhou (motivo em motivoDiario)
+ *
+ * Se algo foi reaplicado, o resultado é compactado na hora: o diário
+ * sempre começa vazio e na época do snapshot.
+ */
+int abrirDiario(const char *caminhoSnapshot, int *descartados)
+{
+    if (snprintf(caminhoDiario, sizeof(caminhoDiario), "%s.diario", caminhoSnapshot) >= (int)sizeof(caminhoDiario))
+    {
+        motivoDiario = "caminho longo demais";
+        return -1;
+    }
+
+    int aplicados = 0;
+    FILE *anterior = fopen(caminhoDiario, "rb");
+
+    *descartados = 0;
+    if (anterior != NULL)
+    {
+        aplicados = reaplicarDiario(anterior, descartados);
+        fclose(anterior);
+        if (aplicados == -1)
+        {
+            return -1;
+        }
+    }
+
+    snapshotDoDiario = caminhoSnapshot;
+
+    if (aplicados > 0)
+    {
+        // Se a pasta não for sincronizada, o diário fica como está
+        epocaSnapshot++;
+        if (salvarSnapshot(caminhoSnapshot) != 1)
+        {
+            motivoDiario = "não foi possível gravar o snapshot compactado";
+            return -1;
+        }
+        mochilaAlterada = 0;
+    }
+
+    arquivoDiario = fopen(caminhoDiario, "wb");
+    if (arquivoDiario == NULL)
+    {
+        motivoDiario = strerror(errno);
+        return -1;
+    }
+    return aplicados;
+}
+
+/*
+ * Função: fecharDiario
+ * Descrição: encerra o diário ao sair, compactando o que houver nele
+ * Parâmetros: nenhum
+ * Retorno: 1 se tudo foi gravado, 0 se alguma gravação falhou
+ */
+int fecharDiario()
+{
+    if (arquivoDiario == NULL && !diarioInterrompido)
+    {
+        return !falhaDiario;
+    }
+
+    sincronizarDiario();
+    if (registrosNoDiario > 0 || (diarioInterrompido && mochilaAlterada))
+    {
+        if (compactarDiario())
+        {
+            falhaDiario = 0; // o snapshot tem tudo o que o diário perdeu
+        }
+    }
+
+    if (arquivoDiario != NULL)
+    {
+        fclose(arquivoDiario);
+        arquivoDiario = NULL;
+    }
+    return !falhaDiario;
+}
+
+/* ========================================
+ * SAÍDA BUFFERIZADA E PAGINAÇÃO
+ * ========================================
+ *
+ * As linhas da tabela são formatadas em um único buffer reutilizável
+ * e enviadas ao terminal de uma vez por página, em vez de um printf
+ * por linha. A listagem interativa mostra TAMANHO_PAGINA itens por
+ * vez, para que mochilas enormes não travem o terminal.
+ */
+
+#define TAMANHO_PAGINA 50
+#define TAMANHO_BUFFER_SAIDA 16384
+
+char bufferSaida[TAMANHO_BUFFER_SAIDA]; // Buffer reutilizado por todas as páginas
+size_t usoBufferSaida = 0;              // Bytes pendentes no buffer
+
+/*
+ * Função: descarregarBuffer
+ * Descrição: envia o conteúdo pendente do buffer ao terminal
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * O stdout é esvaziado antes para manter a ordem com os printf comuns;
+ * depois a página vai direto ao descritor, sem passar de novo pelo
+ * buffer do stdio. Escritas parciais continuam de onde pararam e
+ * interrupções por sinal (EINTR) são repetidas. Se a saída falhar (ex:
+ * terminal ou pipe fechado), o restante da página é descartado.
+ */
+void descarregarBuffer()
+{
+    if (usoBufferSaida == 0)
+    {
+        return;
+    }
+
+    fflush(stdout);
+#ifdef _WIN32
+    fwrite(bufferSaida, 1, usoBufferSaida, stdout);
+    fflush(stdout);
+#else
+    size_t enviados = 0;
+    while (enviados < usoBufferSaida)
+    {
+        ssize_t escritos = write(STDOUT_FILENO, bufferSaida + enviados, usoBufferSaida - enviados);
+        if (escritos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (escritos <= 0)
+        {
+            break;
+        }
+        enviados += (size_t)escritos;
+    }
+#endif
+    usoBufferSaida = 0;
+}
+
+/*
+ * Função: anexarBuffer
+ * Descrição: formata texto (como printf) no final do buffer de saída
+ * Parâmetros: formato e argumentos
+ * Retorno: nenhum
+ *
+ * Se o texto não couber, o buffer é descarregado antes.
+ */
+void anexarBuffer(const char *formato, ...)
+{
+    va_list argumentos;
+
+    va_start(argumentos, formato);
+    int tamanho = vsnprintf(bufferSaida + usoBufferSaida,
+                            TAMANHO_BUFFER_SAIDA - usoBufferSaida, formato, argumentos);
+    va_end(argumentos);
+
+    if (tamanho < 0)
+    {
+        return;
+    }
+
+    if ((size_t)tamanho >= TAMANHO_BUFFER_SAIDA - usoBufferSaida)
+    {
+        descarregarBuffer();
+
+        va_start(argumentos, formato);
+        tamanho = vsnprintf(bufferSaida, TAMANHO_BUFFER_SAIDA, formato, argumentos);
+        va_end(argumentos);
+
+        if (tamanho >= TAMANHO_BUFFER_SAIDA)
+        {
+            tamanho = TAMANHO_BUFFER_SAIDA - 1; // texto truncado
+        }
+    }
+
+    usoBufferSaida += (size_t)tamanho;
+}
+
+/*
+ * Função: posicaoDoItem
+ * Descrição: converte a ordem de um item (0, 1, 2...) em posição na mochila
+ * Parâmetros: ordem do item entre os ativos
+ * Retorno: posição em mochila ou posicoesOcupadas se não existir
+ *
+ * Sem lápides, o acesso é direto; com lápides, percorre as posições.
+ */
+int posicaoDoItem(int ordem)
+{
+    if (totalLapides == 0)
+    {
+        return ordem < posicoesOcupadas ? ordem : posicoesOcupadas;
+    }
+
+    int i = 0;
+    for (; i < posicoesOcupadas; i++)
+    {
+        if (!mochila[i].removido && ordem-- == 0)
+        {
+            break;
+        }
+    }
+    return i;
+}
 
-/* ========================================
- * DEFINIÇÃO DA STRUCT
- * ========================================
- *
- * Struct Item: armazena informações sobre um item do inventário
- * - nome: identificação do item (ex: "Rifle AK")
- * - tipo: categoria do item (ex: "arma", "munição", "cura")
- * - quantidade: número de unidades desse item
+/*
+ * Função: listarPaginaItens
+ * Descrição: exibe uma página da tabela de itens com uma única escrita
+ * Parâmetros: ordem do primeiro item (0 = primeiro) e máximo de itens
+ * Retorno: nenhum
  */
-typedef struct
+void listarPaginaItens(int inicio, int limite)
 {
-    char nome[30];
-    char tipo[20];
-    int quantidade;
-} Item;
+    anexarBuffer("Itens %d a %d de %d\n\n",
+                 inicio + 1,
+                 inicio + limite < totalItens ? inicio + limite : totalItens,
+                 totalItens);
 
-/* ========================================
- * CONSTANTES E VARIÁVEIS GLOBAIS
- * ======================================== */
-#define MAX_ITENS 10
-#define LINHA "=================================================="
+    // Cabeçalho da tabela
+    anexarBuffer("┌─────────┬──────────────────────────┬────────────────┬────────────┐\n");
+    anexarBuffer("│ #       │ Nome do Item             │ Tipo           │ Quantidade │\n");
+    anexarBuffer("├─────────┼──────────────────────────┼────────────────┼────────────┤\n");
+
+    // Linhas da página (pulando lápides)
+    int numero = inicio + 1;
+    for (int i = posicaoDoItem(inicio); i < posicoesOcupadas && limite > 0; i++)
+    {
+        if (mochila[i].removido)
+        {
+            continue;
+        }
+
+        anexarBuffer("│ %7d │ %-24s │ %-14s │ %10d │\n",
+                     numero++,
+                     mochila[i].nome,
+                     nomeDoTipo(mochila[i].tipo),
+                     mochila[i].quantidade);
+        limite--;
+    }
+
+    // Rodapé da tabela
+    anexarBuffer("└─────────┴──────────────────────────┴────────────────┴────────────┘\n\n");
+    descarregarBuffer();
+}
+
+/*
+ * Função: continuarPaginacao
+ * Descrição: pergunta se o jogador quer ver a próxima página
+ * Parâmetros: nenhum
+ * Retorno: 1 para continuar, 0 para parar
+ */
+int continuarPaginacao()
+{
+    char resposta[16];
 
-Item mochila[MAX_ITENS]; // Vetor para armazenar até 10 itens
-int totalItens = 0;      // Contador de itens atualmente na mochila
+    printf("[Enter] próxima página  |  [q] parar: ");
+    if (fgets(resposta, sizeof(resposta), stdin) == NULL)
+    {
+        return 0;
+    }
+    return resposta[0] != 'q' && resposta[0] != 'Q';
+}
 
 /* ========================================
  * FUNÇÃO: listarItens
  * ========================================
- * Descrição: exibe todos os itens registrados na mochila
+ * Descrição: exibe os itens registrados na mochila, página a página
  * Parâmetros: nenhum
  * Retorno: nenhum
  *
  * Comportamento:
  * - Se não houver items, exibe mensagem informativa
- * - Caso contrário, lista todos com nome, tipo e quantidade
+ * - Caso contrário, lista nome, tipo e quantidade em páginas de
+ *   TAMANHO_PAGINA itens, perguntando antes de cada nova página
  */
 void listarItens()
 {
@@ -71,26 +2159,48 @@ void listarItens()
         return;
     }
 
-    printf("Total de itens: %d/10\n\n", totalItens);
+    printf("Total de itens: %d\n", totalItens);
+
+    for (int inicio = 0; inicio < totalItens; inicio += TAMANHO_PAGINA)
+    {
+        if (inicio > 0 && !continuarPaginacao())
+        {
+            break;
+        }
+        listarPaginaItens(inicio, TAMANHO_PAGINA);
+    }
+}
 
-    // Exibe cabeçalho da tabela
-    printf("┌────┬──────────────────────────┬────────────────┬────────────┐\n");
-    printf("│ #  │ Nome do Item             │ Tipo           │ Quantidade │\n");
-    printf("├────┼──────────────────────────┼────────────────┼────────────┤\n");
+/* ========================================
+ * FUNÇÃO: listarResumoItens
+ * ========================================
+ * Descrição: exibe apenas a primeira página da mochila
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Usada após cadastrar ou remover um item: não pergunta nada ao
+ * jogador, apenas indica quantos itens ficaram de fora.
+ */
+void listarResumoItens()
+{
+    printf("\n%s\n", LINHA);
+    printf("           📦 ITENS DO INVENTÁRIO 📦\n");
+    printf("%s\n", LINHA);
 
-    // Percorre e exibe todos os itens em formato tabular
-    for (int i = 0; i < totalItens; i++)
+    if (totalItens == 0)
     {
-        printf("│ %2d │ %-24s │ %-14s │ %10d │\n",
-               i + 1,
-               mochila[i].nome,
-               mochila[i].tipo,
-               mochila[i].quantidade);
+        printf("⚠️  Sua mochila está vazia! Colete itens para começar.\n");
+        printf("%s\n\n", LINHA);
+        return;
     }
 
-    // Exibe rodapé da tabela
-    printf("└────┴──────────────────────────┴────────────────┴────────────┘\n");
-    printf("\n");
+    printf("Total de itens: %d\n", totalItens);
+    listarPaginaItens(0, TAMANHO_PAGINA);
+
+    if (totalItens > TAMANHO_PAGINA)
+    {
+        printf("... e mais %d itens (use a opção 3 para ver todos)\n\n", totalItens - TAMANHO_PAGINA);
+    }
 }
 
 /* ========================================
@@ -101,9 +2211,8 @@ void listarItens()
  * Retorno: nenhum
  *
  * Comportamento:
- * - Verifica se há espaço disponível (máx 10 itens)
  * - Solicita nome, tipo e quantidade ao jogador
- * - Adiciona o item ao vetor
+ * - Adiciona o item ao vetor (que cresce se necessário)
  */
 void inserirItem()
 {
@@ -111,43 +2220,51 @@ void inserirItem()
     printf("         ➕ CADASTRAR NOVO ITEM ➕\n");
     printf("%s\n", LINHA);
 
-    // Verifica se a mochila está cheia
-    if (totalItens >= MAX_ITENS)
-    {
-        printf("❌ Erro: Sua mochila está cheia! Máximo de %d itens.\n", MAX_ITENS);
-        printf("   Remova alguns itens antes de adicionar novos.\n");
-        printf("%s\n\n", LINHA);
-        return;
-    }
-
     // Solicita informações do novo item
+    char nome[30], tipo[20];
+    int quantidade;
+
     printf("Digite o nome do item: ");
-    fgets(mochila[totalItens].nome, sizeof(mochila[totalItens].nome), stdin);
+    fgets(nome, sizeof(nome), stdin);
     // Remove a quebra de linha adicionada por fgets
-    mochila[totalItens].nome[strcspn(mochila[totalItens].nome, "\n")] = 0;
+    nome[strcspn(nome, "\n")] = 0;
 
     printf("Digite o tipo (ex: arma, munição, cura, ferramenta): ");
-    fgets(mochila[totalItens].tipo, sizeof(mochila[totalItens].tipo), stdin);
-    mochila[totalItens].tipo[strcspn(mochila[totalItens].tipo, "\n")] = 0;
+    fgets(tipo, sizeof(tipo), stdin);
+    tipo[strcspn(tipo, "\n")] = 0;
 
     printf("Digite a quantidade: ");
-    scanf("%d", &mochila[totalItens].quantidade);
+    scanf("%d", &quantidade);
     getchar(); // Limpa o buffer de entrada
 
     // Valida a quantidade
-    if (mochila[totalItens].quantidade <= 0)
+    if (quantidade <= 0)
     {
         printf("❌ Erro: A quantidade deve ser maior que zero!\n");
         printf("%s\n\n", LINHA);
         return;
     }
 
-    totalItens++;
-    printf("✅ Item '%s' adicionado com sucesso à mochila!\n", mochila[totalItens - 1].nome);
+    Handle handle;
+    if (procurarTipo(tipo) == -1 && totalTipos == MAX_TIPOS)
+    {
+        printf("❌ Erro: limite de %d tipos diferentes atingido!\n", MAX_TIPOS);
+        printf("%s\n\n", LINHA);
+        return;
+    }
+    if (!adicionarItemMochila(nome, tipo, quantidade, &handle))
+    {
+        printf("❌ Erro: memória insuficiente para guardar o item!\n");
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    printf("✅ Item '%s' adicionado com sucesso à mochila!\n", nome);
+    printf("🔑 Handle do item: %d:%u (use para consumir sem buscar)\n", handle.slot, handle.geracao);
     printf("%s\n", LINHA);
 
     // Exibe a listagem atualizada
-    listarItens();
+    listarResumoItens();
 }
 
 /* ========================================
@@ -159,7 +2276,7 @@ void inserirItem()
  *
  * Comportamento:
  * - Solicita o nome do item a remover
- * - Busca sequencialmente o item
+ * - Localiza o item pelo índice hash
  * - Se encontrado, remove mantendo a ordem
  * - Se não encontrado, exibe mensagem de erro
  */
@@ -182,32 +2299,14 @@ void removerItem()
     fgets(nomeRemover, sizeof(nomeRemover), stdin);
     nomeRemover[strcspn(nomeRemover, "\n")] = 0;
 
-    // Busca sequencial do item
-    int indice = -1;
-    for (int i = 0; i < totalItens; i++)
-    {
-        if (strcmp(mochila[i].nome, nomeRemover) == 0)
-        {
-            indice = i;
-            break;
-        }
-    }
-
-    // Se encontrou, remove o item
-    if (indice != -1)
+    // Busca e remove o item mantendo a ordem dos demais
+    if (removerItemMochila(nomeRemover))
     {
-        printf("✅ Item '%s' encontrado e removido!\n", mochila[indice].nome);
-
-        // Desloca todos os itens posteriores uma posição para frente
-        for (int i = indice; i < totalItens - 1; i++)
-        {
-            mochila[i] = mochila[i + 1];
-        }
-        totalItens--;
+        printf("✅ Item '%s' encontrado e removido!\n", nomeRemover);
         printf("%s\n", LINHA);
 
         // Exibe a listagem atualizada
-        listarItens();
+        listarResumoItens();
     }
     else
     {
@@ -219,13 +2318,13 @@ void removerItem()
 /* ========================================
  * FUNÇÃO: buscarItem
  * ========================================
- * Descrição: realiza busca sequencial de um item pelo nome
+ * Descrição: busca um item pelo nome através do índice hash
  * Parâmetros: nenhum
  * Retorno: nenhum
  *
  * Comportamento:
  * - Solicita o nome do item a buscar
- * - Percorre sequencialmente a mochila
+ * - Consulta o índice hash (sem percorrer a mochila)
  * - Exibe os dados completos se encontrado
  * - Exibe mensagem de erro se não encontrado
  */
@@ -248,26 +2347,283 @@ void buscarItem()
     fgets(nomeBusca, sizeof(nomeBusca), stdin);
     nomeBusca[strcspn(nomeBusca, "\n")] = 0;
 
-    // Busca sequencial
-    int encontrado = 0;
-    for (int i = 0; i < totalItens; i++)
+    // Busca pelo índice hash
+    int indice = buscarIndiceItem(nomeBusca);
+
+    if (indice != -1)
+    {
+        printf("✅ Item encontrado!\n\n");
+        printf("📌 Nome: %s\n", mochila[indice].nome);
+        printf("🏷️  Tipo: %s\n", nomeDoTipo(mochila[indice].tipo));
+        printf("📊 Quantidade: %d\n", mochila[indice].quantidade);
+    }
+    else
+    {
+        printf("❌ Item '%s' não encontrado na mochila!\n", nomeBusca);
+    }
+
+    printf("\n📊 Estatísticas da busca:\n");
+    printf("   Sondagens realizadas: %d\n", sondagensHash);
+    printf("   Complexidade: O(1) esperado (índice hash)\n");
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * FUNÇÃO: consumirItem
+ * ========================================
+ * Descrição: consome unidades de um item a partir do seu handle
+ * Parâmetros: nenhum
+ * Retorno: nenhum
+ *
+ * Comportamento:
+ * - Solicita o handle (exibido ao cadastrar o item) e a quantidade
+ * - Acessa o item em O(1), sem busca por nome
+ * - Remove o item quando a quantidade chega a zero
+ */
+void consumirItem()
+{
+    printf("\n%s\n", LINHA);
+    printf("         💊 CONSUMIR ITEM 💊\n");
+    printf("%s\n", LINHA);
+
+    char texto[32];
+    Handle handle;
+    int unidades;
+
+    printf("Digite o handle do item (ex: 3:1): ");
+    fgets(texto, sizeof(texto), stdin);
+    texto[strcspn(texto, "\n")] = 0;
+
+    int indice = lerHandle(texto, &handle) ? resolverHandle(handle) : -1;
+    if (indice == -1)
+    {
+        printf("❌ Handle '%s' inválido ou de um item já removido!\n", texto);
+        printf("%s\n\n", LINHA);
+        return;
+    }
+
+    // Copia o nome: o item pode sair da mochila ao ser consumido
+    char nome[30];
+    strcpy(nome, mochila[indice].nome);
+
+    printf("Quantas unidades de '%s' consumir (disponível: %d)? ", nome, mochila[indice].quantidade);
+    scanf("%d", &unidades);
+    getchar(); // Limpa o buffer de entrada
+
+    int restante = consumirItemPorHandle(handle, unidades);
+    if (restante == -1)
+    {
+        printf("❌ Erro: quantidade inválida!\n");
+    }
+    else if (restante == 0)
+    {
+        printf("✅ Último '%s' consumido. Item removido da mochila!\n", nome);
+    }
+    else
+    {
+        printf("✅ '%s' consumido! Restam %d unidade(s).\n", nome, restante);
+    }
+    printf("%s\n\n", LINHA);
+}
+
+/* ========================================
+ * MODO ROTEIRO (SEM INTERFACE)
+ * ========================================
+ *
+ * Processa comandos em lote, sem menus nem listagens automáticas. A
+ * saída padrão recebe apenas o resultado das consultas (buscar, listar,
+ * tipo, handle e ler), com buffer grande para sustentar muitas
+ * operações por segundo.
+ */
+
+#define MAX_LINHA_ROTEIRO 256
+#define MAX_CAMPOS_ROTEIRO 4
+
+/*
+ * Função: separarCampos
+ * Descrição: divide uma linha em campos separados por '|'
+ * Parâmetros: linha (modificada no lugar), vetor de campos, máximo de campos
+ * Retorno: número de campos encontrados
+ */
+int separarCampos(char *linha, char *campos[], int maxCampos)
+{
+    int total = 0;
+    char *inicio = linha;
+
+    while (total < maxCampos)
     {
-        if (strcmp(mochila[i].nome, nomeBusca) == 0)
+        campos[total++] = inicio;
+
+        char *separador = strchr(inicio, '|');
+        if (separador == NULL)
         {
-            printf("✅ Item encontrado!\n\n");
-            printf("📌 Nome: %s\n", mochila[i].nome);
-            printf("🏷️  Tipo: %s\n", mochila[i].tipo);
-            printf("📊 Quantidade: %d\n", mochila[i].quantidade);
-            encontrado = 1;
             break;
         }
+        *separador = '\0';
+        inicio = separador + 1;
     }
 
-    if (!encontrado)
+    return total;
+}
+
+/*
+ * Função: executarRoteiro
+ * Descrição: executa os comandos lidos de um arquivo de roteiro
+ * Parâmetros: arquivo de entrada já aberto
+ * Retorno: número de linhas que resultaram em erro
+ */
+int executarRoteiro(FILE *entrada)
+{
+    char linha[MAX_LINHA_ROTEIRO];
+    char *campos[MAX_CAMPOS_ROTEIRO];
+    int numeroLinha = 0;
+    int erros = 0;
+
+    while (fgets(linha, sizeof(linha), entrada) != NULL)
     {
-        printf("❌ Item '%s' não encontrado na mochila!\n", nomeBusca);
+        numeroLinha++;
+        linha[strcspn(linha, "\r\n")] = 0;
+
+        if (linha[0] == '\0' || linha[0] == '#')
+        {
+            continue;
+        }
+
+        int totalCampos = separarCampos(linha, campos, MAX_CAMPOS_ROTEIRO);
+        const char *comando = campos[0];
+
+        if (strcmp(comando, "adicionar") == 0 && totalCampos == 4)
+        {
+            char *fim;
+            long quantidade = strtol(campos[3], &fim, 10);
+
+            if (*campos[3] == '\0' || *fim != '\0' || quantidade <= 0 || quantidade > 2147483647L)
+            {
+                fprintf(stderr, "linha %d: quantidade inválida '%s'\n", numeroLinha, campos[3]);
+                erros++;
+            }
+            else if (procurarTipo(campos[2]) == -1 && totalTipos == MAX_TIPOS)
+            {
+                fprintf(stderr, "linha %d: limite de %d tipos atingido\n", numeroLinha, MAX_TIPOS);
+                erros++;
+            }
+            else if (!adicionarItemMochila(campos[1], campos[2], (int)quantidade, NULL))
+            {
+                fprintf(stderr, "linha %d: memória insuficiente\n", numeroLinha);
+                erros++;
+            }
+        }
+        else if (strcmp(comando, "remover") == 0 && totalCampos == 2)
+        {
+            if (!removerItemMochila(campos[1]))
+            {
+                fprintf(stderr, "linha %d: item '%s' não encontrado\n", numeroLinha, campos[1]);
+                erros++;
+            }
+        }
+        else if (strcmp(comando, "buscar") == 0 && totalCampos == 2)
+        {
+            int indice = buscarIndiceItem(campos[1]);
+
+            if (indice != -1)
+            {
+                printf("%s|%s|%d\n", mochila[indice].nome, nomeDoTipo(mochila[indice].tipo), mochila[indice].quantidade);
+            }
+            else
+            {
+                printf("nao encontrado|%s\n", campos[1]);
+            }
+        }
+        else if (strcmp(comando, "listar") == 0 && (totalCampos == 1 || totalCampos == 3))
+        {
+            int limite = totalItens;
+            int i = 0;
+
+            if (totalCampos == 3)
+            {
+                i = posicaoDoItem(atoi(campos[1]) > 0 ? atoi(campos[1]) : 0);
+                limite = atoi(campos[2]);
+            }
+
+            for (; i < posicoesOcupadas && limite > 0; i++)
+            {
+                if (!mochila[i].removido)
+                {
+                    printf("%s|%s|%d\n", mochila[i].nome, nomeDoTipo(mochila[i].tipo), mochila[i].quantidade);
+                    limite--;
+                }
+            }
+        }
+        else if (strcmp(comando, "tipo") == 0 && totalCampos == 2)
+        {
+            // Sem criar o tipo: um tipo desconhecido não tem itens
+            int numeroTipo = procurarTipo(campos[1]);
+
+            for (int i = 0; numeroTipo != -1 && i < posicoesOcupadas; i++)
+            {
+                if (!mochila[i].removido && mochila[i].tipo == numeroTipo)
+                {
+                    printf("%s|%s|%d\n", mochila[i].nome, nomesTipos[numeroTipo], mochila[i].quantidade);
+                }
+            }
+        }
+        else if (strcmp(comando, "handle") == 0 && totalCampos == 2)
+        {
+            int indice = buscarIndiceItem(campos[1]);
+
+            if (indice != -1)
+            {
+                int slot = mochila[indice].slot;
+                printf("%d:%u\n", slot, slots[slot].geracao);
+            }
+            else
+            {
+                printf("nao encontrado|%s\n", campos[1]);
+            }
+        }
+        else if (strcmp(comando, "ler") == 0 && totalCampos == 2)
+        {
+            Handle handle;
+            int indice = lerHandle(campos[1], &handle) ? resolverHandle(handle) : -1;
+
+            if (indice != -1)
+            {
+                printf("%s|%s|%d\n", mochila[indice].nome, nomeDoTipo(mochila[indice].tipo), mochila[indice].quantidade);
+            }
+            else
+            {
+                printf("handle invalido|%s\n", campos[1]);
+            }
+        }
+        else if (strcmp(comando, "consumir") == 0 && totalCampos == 3)
+        {
+            Handle handle;
+
+            if (!lerHandle(campos[1], &handle) || consumirItemPorHandle(handle, atoi(campos[2])) == -1)
+            {
+                fprintf(stderr, "linha %d: não foi possível consumir '%s' de '%s'\n",
+                        numeroLinha, campos[2], campos[1]);
+                erros++;
+            }
+        }
+        else if (strcmp(comando, "descartar") == 0 && totalCampos == 2)
+        {
+            Handle handle;
+
+            if (!lerHandle(campos[1], &handle) || !removerItemPorHandle(handle))
+            {
+                fprintf(stderr, "linha %d: handle inválido '%s'\n", numeroLinha, campos[1]);
+                erros++;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "linha %d: comando inválido '%s'\n", numeroLinha, comando);
+            erros++;
+        }
     }
-    printf("%s\n\n", LINHA);
+
+    return erros;
 }
 
 /* ========================================
@@ -287,9 +2643,10 @@ int exibirMenu()
     printf("  2️⃣  - Remover item da mochila\n");
     printf("  3️⃣  - Listar todos os itens\n");
     printf("  4️⃣  - Buscar item específico\n");
-    printf("  5️⃣  - Sair do jogo\n");
+    printf("  5️⃣  - Consumir item (por handle)\n");
+    printf("  6️⃣  - Sair do jogo\n");
     printf("%s\n", LINHA);
-    printf("Digite sua opção (1-5): ");
+    printf("Digite sua opção (1-6): ");
 
     int opcao;
     scanf("%d", &opcao);
@@ -303,22 +2660,187 @@ int exibirMenu()
  * ========================================
  * Descrição: função principal do programa
  * Comportamento:
+ * - Com "--reserva N", define a capacidade inicial da mochila
+ * - Com "--remocao lapide|deslocamento", escolhe a estratégia de remoção
+ * - Com "--roteiro [arquivo]", executa o modo roteiro e encerra
+ * - Com "--snapshot arquivo", carrega a mochila do arquivo e grava o
+ *   estado final nele ao sair (se algo mudou)
+ * - Com "--diario", reaplica e mantém o diário de operações do snapshot
  * - Exibe menu até que o usuário escolha sair
  * - Executa ação correspondente à opção
  * - Valida entrada do usuário
  */
-int main()
+int main(int argc, char *argv[])
 {
     int opcao;
 
+    int modoRoteiro = 0;
+    const char *arquivoRoteiro = NULL;
+    const char *arquivoSnapshot = NULL;
+    int usarDiario = 0;
+
+    // Interpreta os argumentos da linha de comando
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--reserva") == 0 && i + 1 < argc)
+        {
+            reservaInicial = atoi(argv[++i]);
+            if (reservaInicial < 1)
+            {
+                fprintf(stderr, "Erro: a reserva deve ser um número positivo\n");
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--remocao") == 0 && i + 1 < argc)
+        {
+            i++;
+            if (strcmp(argv[i], "lapide") == 0)
+            {
+                modoRemocao = REMOCAO_LAPIDE;
+            }
+            else if (strcmp(argv[i], "deslocamento") == 0)
+            {
+                modoRemocao = REMOCAO_DESLOCAMENTO;
+            }
+            else
+            {
+                fprintf(stderr, "Erro: modo de remoção inválido '%s'\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+        {
+            arquivoSnapshot = argv[++i];
+        }
+        else if (strcmp(argv[i], "--diario") == 0)
+        {
+            usarDiario = 1;
+        }
+        else if (strcmp(argv[i], "--grupo") == 0 && i + 1 < argc)
+        {
+            grupoDiario = atoi(argv[++i]);
+            if (grupoDiario < 1)
+            {
+                fprintf(stderr, "Erro: o grupo deve ser um número positivo\n");
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--roteiro") == 0)
+        {
+            modoRoteiro = 1;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0)
+            {
+                arquivoRoteiro = argv[++i];
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Uso: %s [--reserva N] [--remocao lapide|deslocamento] [--roteiro [arquivo]] [--snapshot arquivo [--diario] [--grupo N]]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (usarDiario && arquivoSnapshot == NULL)
+    {
+        fprintf(stderr, "Erro: --diario exige --snapshot\n");
+        return 1;
+    }
+
+    int carregado = 0;
+
+    if (arquivoSnapshot != NULL)
+    {
+        carregado = carregarSnapshot(arquivoSnapshot);
+        if (carregado == -1)
+        {
+            fprintf(stderr, "Erro: snapshot '%s' inválido: %s\n", arquivoSnapshot, motivoSnapshot);
+            return 1;
+        }
+    }
+
+    if (capacidadeMochila == 0 && !redimensionarMochila(reservaInicial))
+    {
+        fprintf(stderr, "Erro: memória insuficiente para a reserva inicial\n");
+        return 1;
+    }
+
+    int reaplicados = 0;
+    int descartados = 0;
+
+    if (usarDiario)
+    {
+        reaplicados = abrirDiario(arquivoSnapshot, &descartados);
+        if (reaplicados == -1)
+        {
+            fprintf(stderr, "Erro: diário de '%s' inválido: %s\n", arquivoSnapshot, motivoDiario);
+            liberarMochila();
+            return 1;
+        }
+        if (descartados > 0)
+        {
+            fprintf(stderr, "Aviso: %d registro(s) incompleto(s) no fim do diário foram descartados\n",
+                    descartados);
+        }
+    }
+
+    // Modo roteiro: processa comandos em lote sem menus
+    if (modoRoteiro)
+    {
+        FILE *entrada = stdin;
+
+        if (arquivoRoteiro != NULL && strcmp(arquivoRoteiro, "-") != 0)
+        {
+            entrada = fopen(arquivoRoteiro, "r");
+            if (entrada == NULL)
+            {
+                fprintf(stderr, "Erro: não foi possível abrir '%s'\n", arquivoRoteiro);
+                liberarMochila();
+                return 1;
+            }
+        }
+
+        // Buffer grande: a saída só é descarregada em blocos
+        setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+
+        int erros = executarRoteiro(entrada);
+
+        if (entrada != stdin)
+        {
+            fclose(entrada);
+        }
+        if (usarDiario && !fecharDiario())
+        {
+            fprintf(stderr, "Erro: falha ao gravar o diário ou compactá-lo em '%s'\n", arquivoSnapshot);
+            erros++;
+        }
+        else if (!usarDiario && arquivoSnapshot != NULL && mochilaAlterada && salvarSnapshot(arquivoSnapshot) != 1)
+        {
+            fprintf(stderr, "Erro: não foi possível gravar o snapshot '%s'\n", arquivoSnapshot);
+            erros++;
+        }
+        liberarMochila();
+        return erros > 0 ? 1 : 0;
+    }
+
     printf("\n╔════════════════════════════════════════════════════╗\n");
     printf("║     BEM-VINDO AO SISTEMA DE INVENTÁRIO 📦         ║\n");
     printf("║     Organize seus itens e sobreviva no jogo!       ║\n");
     printf("╚════════════════════════════════════════════════════╝\n");
 
+    if (carregado)
+    {
+        printf("\n📂 Snapshot '%s' carregado: %d itens na mochila.\n", arquivoSnapshot, totalItens);
+    }
+    if (reaplicados > 0)
+    {
+        printf("📝 Diário: %d operações reaplicadas após o último snapshot.\n", reaplicados);
+    }
+
     // Loop principal do programa
     while (1)
     {
+        // Group commit: nada fica pendente enquanto o jogador decide
+        sincronizarDiario();
         opcao = exibirMenu();
 
         switch (opcao)
@@ -336,13 +2858,41 @@ int main()
             buscarItem();
             break;
         case 5:
+            consumirItem();
+            break;
+        case 6:
+            if (usarDiario)
+            {
+                // O diário já está no disco: se a compactação falhar, ele
+                // é reaplicado na próxima abertura
+                if (!fecharDiario())
+                {
+                    printf("\n⚠️  Não foi possível compactar o diário em '%s'.\n", arquivoSnapshot);
+                }
+                else
+                {
+                    printf("\n💾 Mochila gravada em '%s' (%d itens, %d fsyncs do diário).\n",
+                           arquivoSnapshot, totalItens, sincronizacoesDiario);
+                }
+            }
+            else if (arquivoSnapshot != NULL && mochilaAlterada)
+            {
+                if (salvarSnapshot(arquivoSnapshot) != 1)
+                {
+                    printf("\n❌ Erro: não foi possível gravar o snapshot '%s'.\n", arquivoSnapshot);
+                    break;
+                }
+                printf("\n💾 Mochila gravada em '%s' (%d itens).\n", arquivoSnapshot, totalItens);
+            }
             printf("\n👋 Obrigado por jogar! Até a próxima!\n");
             printf("════════════════════════════════════════════════════\n\n");
+            liberarMochila();
             return 0;
         default:
-            printf("\n❌ Opção inválida! Digite um número entre 1 e 5.\n");
+            printf("\n❌ Opção inválida! Digite um número entre 1 e 6.\n");
         }
     }
 
+    liberarMochila();
     return 0;
 }